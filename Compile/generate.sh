@@ -0,0 +1,2 @@
+clear
+g++ -fdiagnostics-color=always -g -std=c++17 -I ../include ../tools/GenerateLevel.cpp ../src/LevelGenerator.cpp -o ../bin/Level-Generator -Wall -Werror
@@ -0,0 +1,3 @@
+clear
+g++ -fdiagnostics-color=always -g -std=c++17 -I ../include ../tools/PackAssets.cpp ../src/AssetPack.cpp -o ../bin/Pack-Assets -Wall -Werror
+../bin/Pack-Assets ../res ../bin/res.pak
@@ -0,0 +1,2 @@
+clear
+g++ -fdiagnostics-color=always -O2 -std=c++17 -I ../include ../tools/SolveLevel.cpp $(ls ../src/*.cpp | grep -v main.cpp) -o ../bin/Level-Solver -pthread -lSDL2 -lSDL2_gfx -lSDL2_ttf -lSDL2_image -lSDL2_mixer -Wall -Werror
@@ -1,3 +1,3 @@
 clear
-g++ -fdiagnostics-color=always -g -fsanitize=address -std=c++17 -I ../include -DMY_TEST ../test/TestMain.cpp ../src/RigidBody.cpp ../src/LanguageModule.cpp -o ../bin/Cat-Mario-Test -lSDL2 -lSDL2_gfx -lSDL2_ttf -lSDL2_image -lSDL2_mixer -Wall -Werror
+g++ -fdiagnostics-color=always -g -fsanitize=address -std=c++17 -I ../include -DMY_TEST ../test/TestMain.cpp ../src/RigidBody.cpp ../src/Fixed.cpp ../src/LanguageModule.cpp ../src/LevelGenerator.cpp ../src/AssetPack.cpp ../src/PixelCache.cpp ../src/Mixer.cpp ../src/Input.cpp ../src/LatencyProbe.cpp ../src/Arena.cpp ../src/AllocTracker.cpp ../src/StartupReport.cpp ../src/PerformanceConfig.cpp ../src/LevelRegistry.cpp ../src/FramePacer.cpp -o ../bin/Cat-Mario-Test -lSDL2 -lSDL2_gfx -lSDL2_ttf -lSDL2_image -lSDL2_mixer -Wall -Werror
 LSAN_OPTIONS=verbosity=1:log_threads=1 ../bin/Cat-Mario-Test
\ No newline at end of file
@@ -0,0 +1,126 @@
+/** @file AllocTracker.h
+  * @brief Contains class AllocTracker, which counts the allocations of every frame (compile with -DALLOC_TRACK).
+  *
+  * In that build the global operator new and delete are replaced, and every
+  * allocation is counted for the scope that is open on the allocating thread
+  * (see ALLOC_SCOPE). The counters are per thread, so the frames of the main
+  * thread are not disturbed by the background loaders. Allocations made by
+  * SDL itself (malloc) are not counted.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef ALLOC_TRACKER_H
+#define ALLOC_TRACKER_H
+
+#include <iostream>
+#include <cstddef>
+
+#ifdef ALLOC_TRACK
+#define ALLOC_SCOPE(name) AllocTracker::Scope allocScope(name)  ///< Counts the allocations until the end of the block for the given scope.
+#define ALLOC_CACHE_SCOPE(name) AllocTracker::Scope allocScope(name, true)  ///< Same as ALLOC_SCOPE, but the allocations are expected (a cache is filled).
+#else
+#define ALLOC_SCOPE(name)
+#define ALLOC_CACHE_SCOPE(name)
+#endif
+
+/**
+ * @brief Counts the allocations of the current thread for named scopes.
+ */
+class AllocTracker {
+public:
+    static const size_t maxScopes = 32; ///< Static member: maximum number of scopes (the allocations of the others are counted without a scope).
+
+    /**
+     * @brief Number and size of allocations.
+     */
+    struct Counter {
+        size_t allocations = 0; ///< Number of allocations.
+        size_t bytes = 0;       ///< Allocated bytes.
+    };
+
+    /**
+     * @brief Opens a scope for its lifetime: the allocations are counted for it (then for the previous scope again).
+     */
+    class Scope {
+    private:
+        size_t previous;    ///< Index of the scope that was open before this one.
+
+    public:
+        /**
+         * @brief Opens the scope.
+         * @param name Name of the scope (a string literal, it is not copied).
+         * @param expected Contains whether the allocations of the scope are expected (filling a cache), so they do not count as a regression.
+         */
+        Scope(const char* name, bool expected=false);
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        /**
+         * @brief Destructor: closes the scope.
+         */
+        ~Scope();
+    };
+
+private:
+    /**
+     * @brief Counters of a single scope.
+     */
+    struct Entry {
+        const char* name = nullptr; ///< Name of the scope (nullptr for the allocations outside of the scopes).
+        bool expected = false;      ///< Contains whether the allocations of the scope are expected.
+        Counter frame;      ///< Allocations in the current frame.
+        Counter total;      ///< Allocations since the start of the thread.
+    };
+
+    static thread_local Entry entries[maxScopes];   ///< Static member: counters of the scopes of the thread (the first one is for the allocations outside of the scopes).
+    static thread_local size_t entryCount;  ///< Static member: number of used entries.
+    static thread_local size_t current;     ///< Static member: index of the open scope.
+
+    /**
+     * @param name Name of the scope.
+     * @param expected Contains whether the allocations of the scope are expected.
+     * @return Returns the index of the scope (it is added if it is new).
+     */
+    static size_t Find(const char* name, bool expected);
+
+public:
+    /**
+     * @brief Counts an allocation for the open scope (called by operator new).
+     * @param bytes Size of the allocation.
+     */
+    static void Record(size_t bytes);
+
+    /**
+     * @brief Starts a new frame: the counters of the frame are reset.
+     */
+    static void BeginFrame();
+
+    /**
+     * @param includeExpected Contains whether the expected allocations (filling a cache) are counted as well.
+     * @return Returns the allocations of the current frame.
+     */
+    static Counter GetFrame(bool includeExpected=false);
+
+    /**
+     * @param name Name of the scope.
+     * @return Returns the allocations of the scope in the current frame.
+     */
+    static Counter GetFrame(const char* name);
+
+    /**
+     * @brief Prints the scopes that allocated in the current frame.
+     * @param os Output stream.
+     */
+    static void ReportFrame(std::ostream& os);
+
+    /**
+     * @brief Prints the allocations of every scope since the start of the thread.
+     * @param os Output stream.
+     */
+    static void Report(std::ostream& os);
+};
+
+#endif // ALLOC_TRACKER_H
@@ -0,0 +1,57 @@
+/** @file AllocTrackerTest.hpp
+  * @brief This file contains tests for the module AllocTracker
+  *
+  * For testing, it uses the gtest_lite.h library. The test program is not
+  * compiled with -DALLOC_TRACK, so the allocations are recorded by hand.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+# include <iostream>
+
+#include "gtest_lite.h"
+#include "AllocTracker.h"
+
+void TEST_AllocTracker() {
+    /***** Checking the Scopes *****/
+
+    // Checks whether the allocations are counted for the open scope, and the previous scope is restored
+    TEST(AllocTracker, Scope) {
+        AllocTracker::BeginFrame();
+        {
+            AllocTracker::Scope outer("Test::Outer");
+            AllocTracker::Record(16);
+            {
+                AllocTracker::Scope inner("Test::Inner");
+                AllocTracker::Record(32);
+                AllocTracker::Record(8);
+            }
+            AllocTracker::Record(4);
+        }
+        EXPECT_EQ((size_t) 2, AllocTracker::GetFrame("Test::Outer").allocations);
+        EXPECT_EQ((size_t) 20, AllocTracker::GetFrame("Test::Outer").bytes);
+        EXPECT_EQ((size_t) 2, AllocTracker::GetFrame("Test::Inner").allocations);
+        EXPECT_EQ((size_t) 40, AllocTracker::GetFrame("Test::Inner").bytes);
+    } END
+
+    /***** Checking the Frames *****/
+
+    // Checks whether a new frame resets the counters, and the expected allocations (cache) are only counted when asked
+    TEST(AllocTracker, Frame) {
+        AllocTracker::BeginFrame();
+        EXPECT_EQ((size_t) 0, AllocTracker::GetFrame(true).allocations);
+        {
+            AllocTracker::Scope cache("Test::Cache", true);
+            AllocTracker::Record(64);
+        }
+        EXPECT_EQ((size_t) 0, AllocTracker::GetFrame().allocations);
+        EXPECT_EQ((size_t) 1, AllocTracker::GetFrame(true).allocations);
+        {
+            AllocTracker::Scope scope("Test::Outer");
+            AllocTracker::Record(16);
+        }
+        EXPECT_EQ((size_t) 1, AllocTracker::GetFrame().allocations);
+        EXPECT_EQ((size_t) 16, AllocTracker::GetFrame().bytes);
+    } END
+}
@@ -0,0 +1,109 @@
+/** @file Arena.h
+  * @brief Contains class Arena, a monotonic memory arena that is freed in one shot.
+  *
+  * A Level owns an arena for all of its game objects: while the level is bound
+  * to the thread, GameObject::operator new takes the memory from its arena, and
+  * operator delete does not free anything. The memory is given back when the
+  * arena is destroyed (after the objects), so loading and unloading a level
+  * only needs a few allocations.
+  *
+  * The same class is used as a scratch arena for transient data of a single
+  * frame: it is released at the beginning of every frame, and it keeps its
+  * initial buffer, so a frame does not allocate at all.
+  *
+  * Every block taken with Arena::New starts with a small header that stores its
+  * arena, so objects created while no arena is bound (on the heap) can be
+  * deleted the same way.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <cstddef>
+
+/**
+ * @brief Monotonic memory arena.
+ */
+class Arena {
+private:
+    std::unique_ptr<std::byte[]> buffer;    ///< The initial buffer (kept when the arena is released).
+    size_t bufferSize;      ///< Size of the initial buffer in bytes.
+    std::pmr::monotonic_buffer_resource resource;   ///< Hands out the memory (it asks for more from the heap if the buffer is full).
+    size_t used;            ///< Number of bytes taken since the last release.
+
+public:
+    /**
+     * @brief Creates an arena with an initial buffer.
+     * @param initialSize Size of the initial buffer in bytes.
+     */
+    explicit Arena(size_t initialSize);
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    /**
+     * @brief Takes memory from the arena.
+     * @param size Number of bytes.
+     * @param alignment Alignment of the memory.
+     * @return Returns the memory.
+     */
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * @brief Frees everything that was taken from the arena (except the initial buffer).
+     */
+    void Release();
+
+    /**
+     * @return Returns the memory resource of the arena (e.g. for std::pmr::string).
+     */
+    std::pmr::memory_resource* Resource();
+
+    /**
+     * @return Returns the number of bytes taken since the last release.
+     */
+    size_t GetUsed() const;
+
+    /**
+     * @brief Binds the arena to the current thread (nullptr: objects are created on the heap).
+     * @param arena Pointer to the arena.
+     */
+    static void Bind(Arena* arena);
+
+    /**
+     * @brief Unbinds the arena from the current thread if it is bound (necessary before destroying it).
+     * @param arena Pointer to the arena.
+     */
+    static void Unbind(Arena* arena);
+
+    /**
+     * @return Returns the arena bound to the current thread (nullptr if none is bound).
+     */
+    static Arena* Current();
+
+    /**
+     * @brief Allocates memory for an object from the arena bound to the current thread, or from the heap.
+     * @param size Size of the object.
+     * @return Returns the memory of the object.
+     */
+    static void* New(size_t size);
+
+    /**
+     * @brief Frees the memory of an object if it is on the heap (memory of an arena is freed with the arena).
+     * @param memory Memory returned by New.
+     */
+    static void Delete(void* memory);
+
+    /**
+     * @brief Destructor: frees all the memory of the arena at once.
+     */
+    ~Arena();
+};
+
+#endif // ARENA_H
@@ -0,0 +1,60 @@
+/** @file ArenaTest.hpp
+  * @brief This file contains tests for the module Arena
+  *
+  * For testing, it uses the gtest_lite.h library.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+# include <iostream>
+# include <string>
+# include <memory_resource>
+# include <cstdint>
+
+#include "gtest_lite.h"
+#include "Arena.h"
+
+void TEST_Arena() {
+    /***** Checking the Arena *****/
+
+    // Checks whether the memory is aligned, and is taken from the initial buffer until the arena is released
+    TEST(Arena, Allocate) {
+        Arena arena(1024);
+        void* first = arena.Allocate(10);
+        void* second = arena.Allocate(10);
+        EXPECT_EQ((std::uintptr_t) 0, (std::uintptr_t) second % alignof(std::max_align_t));
+        EXPECT_TRUE(first != second);
+        EXPECT_EQ((size_t) 20, arena.GetUsed());
+
+        arena.Release();
+        EXPECT_EQ((size_t) 0, arena.GetUsed());
+        EXPECT_EQ(first, arena.Allocate(10));
+    } END
+
+    // Checks whether the arena is used as a scratch memory resource
+    TEST(Arena, Scratch) {
+        Arena arena(256);
+        std::pmr::string text("x ", arena.Resource());
+        text += "12345678901234567890";
+        EXPECT_EQ(std::string("x 12345678901234567890"), std::string(text));
+    } END
+
+    /***** Checking the Objects *****/
+
+    // Checks whether objects are only taken from the arena while it is bound
+    TEST(Arena, Binding) {
+        Arena arena(1024);
+        Arena::Bind(&arena);
+        void* object = Arena::New(16);
+        EXPECT_TRUE(arena.GetUsed() >= 16);
+        Arena::Delete(object);  // freed with the arena
+
+        Arena::Unbind(&arena);
+        EXPECT_TRUE(Arena::Current() == nullptr);
+        size_t used = arena.GetUsed();
+        void* heapObject = Arena::New(16);
+        EXPECT_EQ(used, arena.GetUsed());
+        Arena::Delete(heapObject);
+    } END
+}
@@ -0,0 +1,121 @@
+/** @file AssetPack.h
+  * @brief Single-file archive of the resources that is memory-mapped at runtime.
+  *
+  * Layout of the archive (native byte order):
+  * - Header: magic "CMPK", version, number of assets, size of the name table.
+  * - Index: one entry per asset, sorted by name, so lookups are binary searches.
+  * - Name table: the names of the assets (relative to res/, e.g. "img/Block.png").
+  * - Payloads: the files themselves, each aligned to AssetPack::alignment bytes.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+/**
+ * @brief Read-only view of a memory-mapped asset archive.
+ */
+class AssetPack {
+public:
+    static const std::uint32_t version;     ///< Static member: version of the archive format.
+    static const std::uint32_t alignment;   ///< Static member: alignment of the payloads in bytes.
+
+    /**
+     * @brief Header at the beginning of the archive.
+     */
+    struct Header {
+        char magic[4];          ///< Always "CMPK".
+        std::uint32_t version;  ///< Version of the archive format.
+        std::uint32_t count;    ///< Number of assets.
+        std::uint32_t namesSize;    ///< Size of the name table in bytes.
+    };
+
+    /**
+     * @brief A single entry of the sorted index.
+     */
+    struct Entry {
+        std::uint64_t offset;   ///< Offset of the payload from the beginning of the archive.
+        std::uint64_t size;     ///< Size of the payload in bytes.
+        std::uint32_t nameOffset;   ///< Offset of the name in the name table.
+        std::uint32_t nameLength;   ///< Length of the name.
+    };
+
+private:
+    const char* data;   ///< Beginning of the mapped archive (nullptr if nothing is opened).
+    size_t size;        ///< Size of the mapped archive in bytes.
+    const Entry* entries;   ///< Sorted index inside the mapped archive.
+    const char* names;      ///< Name table inside the mapped archive.
+    std::uint32_t count;    ///< Number of assets.
+
+    /**
+     * @param entry Entry of the index.
+     * @return Returns the name of the asset.
+     */
+    std::string_view Name(const Entry& entry) const;
+
+    /**
+     * @brief Checks the header and whether every entry is inside the archive.
+     * @return Returns whether the archive is valid.
+     */
+    bool Validate();
+
+public:
+    /**
+     * @brief Creates an empty archive (nothing is opened).
+     */
+    AssetPack();
+
+    AssetPack(const AssetPack&) = delete;
+    AssetPack& operator=(const AssetPack&) = delete;
+
+    /**
+     * @brief Maps the given archive into memory (and closes the previous one).
+     * @param path Path to the archive.
+     * @return Returns false if the file does not exist or it is not a valid archive.
+     */
+    bool Open(const std::string& path);
+
+    /**
+     * @brief Unmaps the archive.
+     */
+    void Close();
+
+    /**
+     * @return Returns whether an archive is opened.
+     */
+    bool IsOpen() const;
+
+    /**
+     * @return Returns the number of assets in the archive.
+     */
+    size_t Count() const;
+
+    /**
+     * @brief Finds an asset without copying it.
+     * @param name Name of the asset relative to res/ (e.g. "img/Block.png").
+     * @return Returns the payload inside the mapped archive (data() is nullptr if it is not found).
+     */
+    std::string_view Find(std::string_view name) const;
+
+    /**
+     * @brief Packs all the files of the directory (recursively) into a single archive.
+     * @param directory Directory of the resources (e.g. "../res").
+     * @param path Path to the archive that is created.
+     * @return Returns the number of packed files.
+     */
+    static size_t Build(const std::string& directory, const std::string& path);
+
+    /**
+     * @brief Destructor: unmaps the archive.
+     */
+    ~AssetPack();
+};
+
+#endif // ASSET_PACK_H
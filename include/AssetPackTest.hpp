@@ -0,0 +1,82 @@
+/** @file AssetPackTest.hpp
+  * @brief This file contains tests for the module AssetPack
+  *
+  * For testing, it uses the gtest_lite.h library.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+# include <iostream>
+# include <fstream>
+# include <sstream>
+# include <string>
+# include <filesystem>
+# include <cstdint>
+
+#include "gtest_lite.h"
+#include "AssetPack.h"
+#include "LanguageModule.h"
+
+void TEST_AssetPack() {
+    const std::string path = (std::filesystem::temp_directory_path() / "Cat-Mario-Test.pak").string();
+
+    /***** Checking Build and Open *****/
+
+    // Checks whether all the resources are packed and the pack can be opened
+    TEST(AssetPack, BuildAndOpen) {
+        size_t files = 0;
+        for (auto& file : std::filesystem::recursive_directory_iterator("../res"))
+            if (file.is_regular_file())
+                ++files;
+
+        EXPECT_EQ(files, AssetPack::Build("../res", path));
+
+        AssetPack pack;
+        EXPECT_TRUE(pack.Open(path));
+        EXPECT_EQ(files, pack.Count());
+    } END
+
+    // Checks for throwing error for a missing directory, and for rejecting invalid files
+    TEST(AssetPack, Invalid) {
+        EXPECT_ANY_THROW(AssetPack::Build("../res/missing", path + ".missing"));
+
+        AssetPack pack;
+        EXPECT_FALSE(pack.Open("../res/missing.pak"));
+        EXPECT_FALSE(pack.Open("../res/lang/English.txt"));
+        EXPECT_FALSE(pack.IsOpen());
+    } END
+
+    /***** Checking Find *****/
+
+    // Checks whether the payloads match the loose files and whether they are aligned
+    TEST(AssetPack, Find) {
+        AssetPack pack;
+        pack.Open(path);
+
+        for (const char* name : { "lang/English.txt", "img/Block.png", "levels/Level1.txt" }) {
+            std::ifstream file(std::string("../res/") + name, std::ios::binary);
+            std::stringstream loose;
+            loose << file.rdbuf();
+
+            std::string_view asset = pack.Find(name);
+            EXPECT_TRUE(asset.data() != nullptr);
+            EXPECT_TRUE(asset == loose.str());
+            EXPECT_EQ((std::uintptr_t) 0, (std::uintptr_t) asset.data() % AssetPack::alignment);
+        }
+
+        EXPECT_TRUE(pack.Find("img/Missing.png").data() == nullptr);
+        EXPECT_TRUE(pack.Find("img").data() == nullptr);
+    } END
+
+    // Checks whether a language module can be loaded from the pack
+    TEST(AssetPack, LanguageModule) {
+        AssetPack pack;
+        pack.Open(path);
+        std::string_view asset = pack.Find("lang/Hungarian.txt");
+        std::istringstream in{std::string(asset)};
+        EXPECT_NO_THROW(LanguageModule{in});
+    } END
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,87 @@
+/** @file Assets.h
+  * @brief Opens the resources from the asset pack, or from the loose res/ directory as a fallback.
+  *
+  * Assets are named relative to res/ (e.g. "img/Block.png"). Both the asset
+  * pack and the res/ directory are located relative to the executable, so the
+  * game does not have to be started from bin/.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef ASSETS_H
+#define ASSETS_H
+
+#ifndef CPORTA
+
+#include <SDL2/SDL.h>
+
+#include <iostream>
+#include <string>
+#include <memory>
+#include <string_view>
+
+#include "AssetPack.h"
+
+/**
+ * @brief Resolves asset names to the mapped asset pack or to loose files.
+ */
+class Assets {
+private:
+    static AssetPack pack;  ///< Static member: the mapped asset pack (not opened if it is missing).
+    static std::string resourceDirectory;   ///< Static member: path to the loose res/ directory (with trailing slash).
+    static std::string cacheDirectory;      ///< Static member: path to the directory of the decoded texture and sound cache (with trailing slash).
+    static std::string baseDirectory;       ///< Static member: path to the directory of the executable (with trailing slash).
+
+public:
+    /**
+     * @brief Finds the res/ directory, creates the cache directory (bin/cache/) and maps the asset pack (bin/res.pak) if it exists.
+     * With -DHOT_RELOAD the asset pack is ignored, so that edited files are used.
+     */
+    static void Init();
+
+    /**
+     * @param name Name of the asset relative to res/.
+     * @return Returns the path to the loose file.
+     */
+    static std::string Path(const std::string& name);
+
+    /**
+     * @param name Name of a file next to the executable (e.g. config.txt).
+     * @return Returns the path to the file.
+     */
+    static std::string LocalPath(const std::string& name);
+
+    /**
+     * @param name Name of the asset relative to res/.
+     * @param extension Extension of the cache file (".tex" for textures, ".pcm" for sounds).
+     * @return Returns the path to the cache file that belongs to the asset (see PixelCache).
+     */
+    static std::string CachePath(const std::string& name, const std::string& extension = ".tex");
+
+    /**
+     * @brief Reads the whole asset. Packed assets are not copied.
+     * @param name Name of the asset relative to res/.
+     * @param buffer Loose files are read into this buffer.
+     * @return Returns the contents of the asset (data() is nullptr if it is not found).
+     */
+    static std::string_view Read(const std::string& name, std::string& buffer);
+
+    /**
+     * @brief Opens an asset for SDL. Packed assets are not copied (SDL_RWFromConstMem).
+     * @param name Name of the asset relative to res/.
+     * @return Returns the opened stream (nullptr if the asset is not found). The caller has to close it.
+     */
+    static SDL_RWops* Open(const std::string& name);
+
+    /**
+     * @brief Opens a text asset (e.g. a language or level file) as an input stream.
+     * @param name Name of the asset relative to res/.
+     * @return Returns the opened stream (nullptr if the asset is not found).
+     */
+    static std::unique_ptr<std::istream> OpenStream(const std::string& name);
+};
+
+#endif // CPORTA
+
+#endif // ASSETS_H
@@ -18,6 +18,7 @@
 #include <SDL2/SDL_image.h>
 
 #include <iostream>
+#include <memory>
 
 #include "GameObject.h"
 #include "Texture.h"
@@ -71,6 +72,11 @@ public:
      */
     virtual void Limit(Entity* entity);
 
+    /**
+     * @return Returns a copy of the block with its current state (necessary for cloning the level).
+     */
+    virtual std::unique_ptr<Block> Clone() const;
+
     /**
      * @brief Virtual destructor.
      */
@@ -83,8 +89,7 @@ public:
  */
 class HiddenBlock : public Block {
     friend class GameEngine;    ///< Necessary for playing animation.
-private:
-    bool playAnimation; ///< This is how the block shows that it wants to play an animation.
+    friend class Level;         ///< Necessary for simulating the level.
 public:
     /**
      * Creates a new HiddenBlock with the given boxes.
@@ -106,6 +111,11 @@ public:
      */
     void TouchedBy(Entity* entity) override;
 
+    /**
+     * @return Returns a copy of the block with its current state (necessary for cloning the level).
+     */
+    std::unique_ptr<Block> Clone() const override;
+
     /**
      * @brief Destructor.
      */
@@ -118,8 +128,7 @@ public:
  */
 class BrickBlock : public Block {
     friend class GameEngine;    ///< Necessary for playing animation.
-private:
-    bool playAnimation; ///< This is how the block shows that it wants to play an animation.
+    friend class Level;         ///< Necessary for simulating the level.
 public:
     /**
      * Creates a new BrickBlock with the given boxes.
@@ -136,6 +145,11 @@ public:
      */
     void TouchedBy(Entity* entity) override;
 
+    /**
+     * @return Returns a copy of the block with its current state (necessary for cloning the level).
+     */
+    std::unique_ptr<Block> Clone() const override;
+
     /**
      * @brief Destructor.
      */
@@ -148,8 +162,7 @@ public:
  */
 class MysteryBlock : public Block {
     friend class GameEngine;    ///< Necessary for playing animation.
-private:
-    bool playAnimation; ///< This is how the block shows that it wants to play an animation.
+    friend class Level;         ///< Necessary for simulating the level.
 public:
     /**
      * Creates a new MysteryBlock with the given boxes.
@@ -176,6 +189,11 @@ public:
      */
     void TouchedBy(Entity* entity) override;
 
+    /**
+     * @return Returns a copy of the block with its current state (necessary for cloning the level).
+     */
+    std::unique_ptr<Block> Clone() const override;
+
     /**
      * @brief Destructor.
      */
@@ -188,6 +206,7 @@ public:
  */
 class Grid {
     friend class GameEngine;    ///< Necessary for setting up the level.
+    friend class Level;         ///< Necessary for simulating the level.
 private:
     int width;      ///< Width of the grid counted in blocks.
     int height;     ///< Height of the grid counted in blocks.
@@ -202,6 +221,19 @@ public:
      */
     Grid(int blockSize);
 
+    /**
+     * @brief Copy constructor. Clones every non-empty block with its current state (necessary for cloning the level).
+     * @param other The grid that is copied.
+     */
+    Grid(const Grid& other);
+
+    /**
+     * @brief Copy assignment. Clones every non-empty block of the other grid with its current state.
+     * @param other The grid that is copied.
+     * @return Returns reference to the grid.
+     */
+    Grid& operator=(const Grid& other);
+
     /**
      * @brief Initialises the grid with (width * height) blocks (nullptr).
      * @param width Width of the grid counted in blocks.
@@ -0,0 +1,136 @@
+/** @file Components.h
+  * @brief Contains class Components, which stores the state of the game objects of a level in contiguous arrays.
+  *
+  * Every game object owns a slot in the arrays (its id), and the object itself only refers
+  * to its slot. The per-frame passes (systems) iterate the arrays linearly instead of
+  * calling the objects one by one, and copying the components copies the state of every
+  * object of the level at once.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef COMPONENTS_H
+#define COMPONENTS_H
+
+#ifndef CPORTA
+
+#include <SDL2/SDL.h>
+
+#include <iostream>
+#include <vector>
+
+#include "Texture.h"
+#include "RigidBody.h"
+
+namespace ObjectKind {
+    enum Kind { NONE=0, PLAYER, ENEMY, BLOCK, ELEMENT };   ///< Kind of the game object in a slot (NONE if the slot is free).
+}
+
+/**
+ * @brief Transform component: where the object is.
+ */
+struct Transform {
+    SDL_Rect hitBox;    ///< Hitbox of the object.
+    SDL_Rect previousPosition;  ///< Hitbox in the previous update cycle (necessary for recovering entities from collision).
+};
+
+/**
+ * @brief Activation and flags component: the state that the systems branch on.
+ */
+struct Flags {
+    Uint8 kind;         ///< Kind of the object (see ObjectKind).
+    Uint8 type;         ///< Type of the object within its kind (the EnemyType of enemies, 0 for the rest).
+    bool isRemoved;     ///< Represents an object beeing destroyed.
+    bool isActivated;   ///< Contains whether the enemy or level element is activated.
+    bool faceLeft;      ///< Contains whether the entity faces to the left.
+    bool playSound;     ///< This is how the object shows that it wants to play a sound (or an animation, for blocks).
+    bool hasCollided;   ///< Contains whether the entity has collided in a single update session.
+    bool isSqueezed;    ///< Contains whether the enemy is squeezed (SoldierEnemy).
+    bool isSliding;     ///< Contains whether the enemy is sliding (SoldierEnemy).
+};
+
+/**
+ * @brief Component storage of the game objects of a level (a structure of arrays indexed by the id of the objects).
+ */
+class Components {
+private:
+    std::vector<Transform> transforms;  ///< Transform component of every slot.
+    std::vector<RigidBody> bodies;      ///< Rigid body component of every slot (entities, and level elements that move at a constant velocity, move by it).
+    std::vector<Texture> sprites;       ///< Sprite component of every slot (the textures are shared, they are never destroyed by the sprites).
+    std::vector<Flags> flags;           ///< Activation and flags component of every slot.
+    size_t freeSlots;   ///< Number of slots of destroyed objects that can be reused (destroying an object never allocates).
+
+public:
+    /**
+     * @brief Creates an empty storage.
+     */
+    Components();
+
+    /**
+     * @brief Creates the components of a new object (in a free slot if there is one).
+     * @param kind Kind of the object.
+     * @param hitBox Hitbox of the object.
+     * @param sprite Sprite of the object.
+     * @param isRemoved Represents an object beeing destroyed.
+     * @return Returns the id of the object.
+     */
+    size_t Create(ObjectKind::Kind kind, SDL_Rect hitBox, const Texture& sprite, bool isRemoved=false);
+
+    /**
+     * @brief Frees the slot of a destroyed object.
+     * @param id Id of the object.
+     */
+    void Destroy(size_t id);
+
+    /**
+     * @return Returns the number of slots (including the free ones).
+     */
+    size_t Size() const;
+
+    /**
+     * @param id Id of the object.
+     * @return Returns the transform component of the object.
+     */
+    Transform& GetTransform(size_t id) { return transforms[id]; }
+
+    /**
+     * @param id Id of the object.
+     * @return Returns the rigid body component of the object.
+     */
+    RigidBody& GetRigidBody(size_t id) { return bodies[id]; }
+
+    /**
+     * @param id Id of the object.
+     * @return Returns the sprite component of the object.
+     */
+    Texture& GetSprite(size_t id) { return sprites[id]; }
+
+    /**
+     * @param id Id of the object.
+     * @return Returns the activation and flags component of the object.
+     */
+    Flags& GetFlags(size_t id) { return flags[id]; }
+
+    /**
+     * @brief System: moves the destination rectangles of the sprites to where their hitboxes are on the screen.
+     * @param ids Ids of the objects (e.g. the visible ones).
+     * @param screen How the screen (camera) is moved.
+     */
+    void UpdateDestRects(const std::vector<size_t>& ids, const SDL_Rect& screen);
+
+    /**
+     * @brief System: stores the hitboxes of the entities as their previous positions.
+     * @param ids Ids of the entities.
+     */
+    void UpdatePreviousPositions(const std::vector<size_t>& ids);
+
+    /**
+     * @brief Destructor.
+     */
+    ~Components();
+};
+
+#endif // CPORTA
+
+#endif // COMPONENTS_H
@@ -13,10 +13,13 @@
 #include <SDL2/SDL_image.h>
 
 #include <iostream>
+#include <memory>
+#include <string_view>
 
 #include "GameObject.h"
 #include "Texture.h"
 #include "RigidBody.h"
+#include "Components.h"
 #include "Timer.h"
 
 /**********************************************************************************************************************************************/
@@ -26,28 +29,25 @@
  */
 class Entity : public GameObject {
     friend class GameEngine;
+    friend class Level;
 public:
     static SDL_Texture* textures;   ///< Static member. Stores all the Entity textures.
 protected:
-    RigidBody rigidBody;    ///< Rigid body component.
     SDL_Rect spawnPoint;    ///< Spawn point that the entity is reset to.
-    SDL_Rect previousPosition;  ///< Necessary for recovering from collision.
-    bool hasCollided;   ///< Contains whether the entity has collided in a single update session.
     bool recoverX;  ///< x coordinate to recover to.
     bool recoverY;  ///< y coordinate to recover to.
-    bool faceLeft;  ///< Contains whether entity faces to the left (false if it faces to the right).
-    bool playSound; ///< This is how it shows that it wants to play a sound.
 
 public:
     /**
      * Creates a new Entity with the given boxes and members.
+     * @param kind Kind of the entity (player or enemy).
      * @param hitBox Hitbox of the Entity.
      * @param srcRect Source rectangle for the Texture.
      * @param destRect Destination rectangle for the Texture.
      * @param faceLeft Contains whether the entity faces left (or right).
      * @see SDL_Rect
      */
-    Entity(SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect, bool faceLeft=true);
+    Entity(ObjectKind::Kind kind, SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect, bool faceLeft=true);
 
     /**
      * @brief Updates the entity with delta time.
@@ -97,9 +97,9 @@ public:
     bool HasCollided() const;
 
     /**
-     * @return Returns reference to the rigid body.
+     * @return Returns reference to the position in the previous update cycle.
      */
-    RigidBody& GetRigidBody();
+    SDL_Rect& PreviousPosition();
 
     /**
      * @brief Updates previous position (necessary for handling collision later).
@@ -124,8 +124,8 @@ public:
  */
 class Player : public Entity {
     friend class GameEngine;
+    friend class Level;
 public:
-    static int position;    ///< x Static member. Contains x coordinate and width of its hit box (necessary for activating e.g. Fish or Laser).
     static int GetPosition();   ///< Necessary for comparison with Enemy's activationPoint.
 
 private:
@@ -134,6 +134,8 @@ private:
     bool isForcedByFlag;    ///< Contains whether the player is forced by flag.
     int bottomOfFlag;   ///< y coordinate that is the bottom of the end flag.
     bool onGround;      ///< Contains whether the player in on the ground in a single update session.
+    float airTime;      ///< Time since the player left the ground in milliseconds (necessary for the coyote time).
+    bool hasJumped;     ///< Contains whether the player has jumped since it last landed (the coyote time does not allow a second jump).
     bool jump;  ///< Contains whether the player is jumping.
     Timer jumpTime; ///< Stores the current jump time of the player.
     bool runSprite; ///< Contains whether the player is on run sprite (or stand sprite).
@@ -218,20 +220,40 @@ public:
 
 /**********************************************************************************************************************************************/
 
+namespace EnemyType {
+    enum Type { COMMON=0, SOLDIER, KING, RED_MUSHROOM, PURPLE_MUSHROOM, COUNT };  ///< Type of the enemy (COUNT if the type is unknown).
+}
+
+/**
+ * @brief Everything that is the same for all the enemies of a type. Shared by the loading of levels and the spawns of MysteryBlock(s).
+ */
+struct EnemyArchetype {
+    const char* name;   ///< Name of the config section (e.g. "CommonEnemy").
+    int width;  ///< Width of the hitbox.
+    int height; ///< Height of the hitbox.
+    SDL_Rect srcRect;   ///< Source rectangle for the Texture.
+    int shiftTextureRight;  ///< Contains how much the texture is shifted to the right (necessary for rendering the sprite when the enemy faces to the left).
+    int spawnHeight;    ///< How high above a MysteryBlock the enemy is spawned.
+};
+
 /**
  * @brief Enemy base class inherited from class Entity.
 */
 class Enemy : public Entity {
     friend class GameEngine;
+    friend class Level;
+public:
+    static const EnemyArchetype archetypes[EnemyType::COUNT];  ///< Static member: archetypes of the enemies indexed by their type.
+
 protected:
     bool faceLeftDefault;   ///< Contains whether the enemy faces left by default.
-    bool isActivated;       ///< Contains whether the enemy is activated.
     int activationPoint;    ///< When the player reaches this x coordinate, the enemy gets activated.
     int shiftTextureRight;  ///< Contains how much the texture is shifted to the right (necessary for rendering the sprite when the enemy faces to the left).
 
 public:
     /**
      * Creates a new Enemy with the given boxes and members.
+     * @param type Type of the enemy (stored in its flags, the systems branch on it).
      * @param hitBox Hitbox of the Enemy.
      * @param activationPoint x coordinate where the enemy is activated.
      * @param srcRect Source rectangle for the Texture.
@@ -240,7 +262,7 @@ public:
      * @param faceLeft Contains whether the enemy is facing left.
      * @see SDL_Rect
      */
-    Enemy(SDL_Rect hitBox, int activationPoint, SDL_Rect srcRect, int shiftTextureRight, SDL_Rect destRect, bool faceLeft);
+    Enemy(EnemyType::Type type, SDL_Rect hitBox, int activationPoint, SDL_Rect srcRect, int shiftTextureRight, SDL_Rect destRect, bool faceLeft);
 
     /**
      * @brief Updates the enemy with delta time.
@@ -258,6 +280,25 @@ public:
      */
     virtual void Reset();
 
+    /**
+     * @brief Moves the enemy to a new spawn point and resets it (so a removed enemy can be used again instead of creating a new one).
+     * @param x x coordinate of the new spawn point.
+     * @param y y coordinate of the new spawn point.
+     * @param activationPoint When the player reaches this x coordinate, the enemy gets activated.
+     * @param faceLeft Contains whether enemy faces left.
+     */
+    void Respawn(int x, int y, int activationPoint, bool faceLeft);
+
+    /**
+     * @return Returns the x coordinate where the enemy is activated (when the player's position reaches it).
+     */
+    int GetActivationPoint() const;
+
+    /**
+     * @brief Activates the enemy, so it starts moving (called by the Level when the player reaches the activation point).
+     */
+    void Activate();
+
     /**
      * @brief Touches another object.
      * @param object The touched object.
@@ -277,10 +318,55 @@ public:
      */
     virtual void Kill();
 
+    /**
+     * @return Returns a copy of the enemy with its current state (necessary for cloning the level).
+     */
+    virtual std::unique_ptr<Enemy> Clone() const = 0;
+
+    /**
+     * @return Returns the type of the enemy (necessary for putting it back to the right pool).
+     */
+    EnemyType::Type GetType() const;
+
+    /**
+     * @brief Static function: creates an enemy from its archetype.
+     * @param type Type of the enemy.
+     * @param x x coordinate of spawn point.
+     * @param y y coordinate of spawn point.
+     * @param activationPoint When the player reaches this x coordinate, the enemy gets activated.
+     * @param faceLeft Contains whether enemy faces left.
+     * @return Returns the new enemy.
+     */
+    static std::unique_ptr<Enemy> Create(EnemyType::Type type, int x, int y, int activationPoint, bool faceLeft);
+
+    /**
+     * @brief Static function: looks up the type of an enemy by the name of its config section.
+     * @param name Name of the config section (e.g. "CommonEnemy").
+     * @return Returns the type of the enemy, or EnemyType::COUNT if there is no such enemy.
+     */
+    static EnemyType::Type FindType(std::string_view name);
+
+    /**
+     * @brief Static function, system: moves the given enemies in a single linear pass over their components (with the logic of their type).
+     * @param components Components of the level.
+     * @param ids Ids of the active enemies (removed ones are skipped).
+     * @param dt Delta time.
+     */
+    static void UpdateAll(Components& components, const std::vector<size_t>& ids, float dt);
+
     /**
      * @brief Destructor.
      */
     ~Enemy();
+
+private:
+    /**
+     * @brief Static function: moves a single enemy by its rigid body (a sliding SoldierEnemy is faster, a squeezed one stands still).
+     * @param components Components of the level.
+     * @param id Id of the enemy.
+     * @param dt Delta time.
+     */
+    static void Move(Components& components, size_t id, float dt);
 };
 
 /**********************************************************************************************************************************************/
@@ -309,6 +395,11 @@ public:
      */
     void TouchedBy(Entity* entity);
 
+    /**
+     * @return Returns a copy of the enemy with its current state (necessary for cloning the level).
+     */
+    std::unique_ptr<Enemy> Clone() const override;
+
     /**
      * @brief Destructor.
      */
@@ -321,10 +412,6 @@ public:
  * @brief SoldierEnemy class inherited from class Enemy.
 */
 class SoldierEnemy : public Enemy {
-private:
-    bool isSqueezed;    ///< Contains whether the enemy is squeezed.
-    bool isSliding;     ///< Contains whether the enemy is sliding.
-
 public:
     /**
      * Creates a new SoldierEnemy with the given boxes and members.
@@ -338,12 +425,6 @@ public:
      */
     SoldierEnemy(SDL_Rect hitBox, int activationPoint, SDL_Rect srcRect, int shiftTextureRight, SDL_Rect destRect, bool faceLeft);
 
-    /**
-     * @brief Updates the enemy with delta time.
-     * @param dt Delta time.
-     */
-    void Update(float dt) override;
-
     /**
      * @brief Resets the enemy to default state.
      */
@@ -361,6 +442,11 @@ public:
      */
     bool IsSqueezed() const;
 
+    /**
+     * @return Returns a copy of the enemy with its current state (necessary for cloning the level).
+     */
+    std::unique_ptr<Enemy> Clone() const override;
+
     /**
      * @brief Destructor.
      */
@@ -393,6 +479,11 @@ public:
      */
     void TouchedBy(Entity* entity);
 
+    /**
+     * @return Returns a copy of the enemy with its current state (necessary for cloning the level).
+     */
+    std::unique_ptr<Enemy> Clone() const override;
+
     /**
      * @brief Destructor.
      */
@@ -425,6 +516,11 @@ public:
      */
     void TouchedBy(Entity* entity);
 
+    /**
+     * @return Returns a copy of the enemy with its current state (necessary for cloning the level).
+     */
+    std::unique_ptr<Enemy> Clone() const override;
+
     /**
      * @brief Destructor.
      */
@@ -457,6 +553,11 @@ public:
      */
     void TouchedBy(Entity* entity);
 
+    /**
+     * @return Returns a copy of the enemy with its current state (necessary for cloning the level).
+     */
+    std::unique_ptr<Enemy> Clone() const override;
+
     /**
      * @brief Destructor.
      */
@@ -0,0 +1,145 @@
+/** @file Fixed.h
+  * @brief Contains class Fixed, a fixed-point number used by the physics.
+  *
+  * The physics state (velocity and sub-pixel position) is stored in
+  * fixed-point, so it is advanced by integer arithmetic only. This way
+  * every compiler and optimization level produces the same movement,
+  * which is necessary for replaying a recorded input sequence.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef FIXED_H
+#define FIXED_H
+
+#include <iostream>
+#include <cstdint>
+
+/**
+ * @brief Signed fixed-point number with 16 fractional bits stored in a 64-bit integer.
+ */
+class Fixed {
+public:
+    static const int fractionBits;  ///< Static member: number of fractional bits.
+    static const int64_t one;       ///< Static member: raw value of 1.0.
+
+private:
+    int64_t raw;    ///< The value multiplied by 2^fractionBits.
+
+public:
+    /**
+     * @brief Creates a new fixed-point number from an integer (or zero by default).
+     * @param value Integer value.
+     */
+    Fixed(int value = 0);
+
+    /**
+     * @brief Converts a float to fixed-point, rounding to the nearest representable value.
+     * @param value Float value.
+     * @return Returns the fixed-point number.
+     */
+    static Fixed FromFloat(float value);
+
+    /**
+     * @param raw The value multiplied by 2^fractionBits.
+     * @return Returns the fixed-point number with the given raw value.
+     */
+    static Fixed FromRaw(int64_t raw);
+
+    /**
+     * @return Returns the raw value (the value multiplied by 2^fractionBits).
+     */
+    int64_t Raw() const;
+
+    /**
+     * @return Returns the value as a float (exact if the integer part is below 256).
+     */
+    float ToFloat() const;
+
+    /**
+     * @return Returns the largest integer that is not greater than the value.
+     */
+    int Floor() const;
+
+    /****************************************************************************************/
+
+    /**
+     * @param rhs The other number that we are comparing to.
+     * @return Returns whether the values match.
+     */
+    bool operator==(const Fixed& rhs) const;
+
+    /**
+     * @param rhs The other number that we are comparing to.
+     * @return Returns whether the values do not match.
+     */
+    bool operator!=(const Fixed& rhs) const;
+
+    /**
+     * @param rhs The other number that we are comparing to.
+     * @return Returns whether this value is less than the other one.
+     */
+    bool operator<(const Fixed& rhs) const;
+
+    /**
+     * @param rhs The other number that we are comparing to.
+     * @return Returns whether this value is greater than the other one.
+     */
+    bool operator>(const Fixed& rhs) const;
+
+    /****************************************************************************************/
+
+    /**
+     * @return Returns the negated value.
+     */
+    Fixed operator-() const;
+
+    /**
+     * @param rhs The other operand on the right-hand side.
+     * @return Returns a new number with the value of lhs + rhs.
+     */
+    Fixed operator+(const Fixed& rhs) const;
+
+    /**
+     * @param rhs The other operand on the right-hand side.
+     * @return Returns a new number with the value of lhs - rhs.
+     */
+    Fixed operator-(const Fixed& rhs) const;
+
+    /**
+     * @param rhs The other operand on the right-hand side.
+     * @return Returns a new number with the value of lhs * rhs (rounded down).
+     */
+    Fixed operator*(const Fixed& rhs) const;
+
+    /**
+     * @param rhs The other operand on the right-hand side.
+     * @return Returns a new number with the value of lhs / rhs (rounded towards zero).
+     */
+    Fixed operator/(const Fixed& rhs) const;
+
+    /**
+     * @param rhs The other operand on the right-hand side.
+     * @return Returns a reference of this changed number with the value of lhs + rhs.
+     */
+    Fixed& operator+=(const Fixed& rhs);
+
+    /**
+     * @param rhs The other operand on the right-hand side.
+     * @return Returns a reference of this changed number with the value of lhs - rhs.
+     */
+    Fixed& operator-=(const Fixed& rhs);
+
+    /****************************************************************************************/
+
+    /**
+     * @brief Operator<< overload. Prints the value to the given output stream.
+     * @param os Output stream reference that the value is printed to.
+     * @param value The printed number.
+     * @return Returns the given output stream as reference.
+     */
+    friend std::ostream& operator<<(std::ostream& os, const Fixed& value);
+};
+
+#endif // FIXED_H
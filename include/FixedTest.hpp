@@ -0,0 +1,70 @@
+/** @file FixedTest.hpp
+  * @brief This file contains tests for the module Fixed
+  *
+  * For testing, it uses the gtest_lite.h library.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+# include <iostream>
+
+#include "gtest_lite.h"
+#include "Fixed.h"
+
+void TEST_Fixed() {
+    /***** Checking the Conversions *****/
+    TEST(Fixed, Constructor) {
+        EXPECT_EQ((int64_t) 0, Fixed().Raw());
+        EXPECT_EQ(Fixed::one * 3, Fixed(3).Raw());
+        EXPECT_EQ(-Fixed::one, Fixed(-1).Raw());
+        EXPECT_FLOAT_EQ(-1.0f, Fixed(-1).ToFloat());
+    } END
+
+    TEST(Fixed, FromFloat) {
+        EXPECT_FLOAT_EQ(0.5f, Fixed::FromFloat(0.5f).ToFloat());
+        EXPECT_FLOAT_EQ(-1.25f, Fixed::FromFloat(-1.25f).ToFloat());
+        EXPECT_EQ(Fixed::one / 4, Fixed::FromFloat(0.25f).Raw());
+        // Rounds to the nearest representable value
+        EXPECT_EQ((int64_t) 6554, Fixed::FromFloat(0.1f).Raw());
+        EXPECT_EQ((int64_t) -6554, Fixed::FromFloat(-0.1f).Raw());
+    } END
+
+    TEST(Fixed, Floor) {
+        EXPECT_EQ(2, Fixed::FromFloat(2.75f).Floor());
+        EXPECT_EQ(0, Fixed::FromFloat(0.5f).Floor());
+        EXPECT_EQ(-1, Fixed::FromFloat(-0.5f).Floor());
+        EXPECT_EQ(-3, Fixed(-3).Floor());
+    } END
+
+    /***** Checking the Operators *****/
+    TEST(Fixed, Comparison) {
+        EXPECT_TRUE(Fixed(2) == Fixed::FromFloat(2.0f));
+        EXPECT_TRUE(Fixed(2) != Fixed(3));
+        EXPECT_TRUE(Fixed(-2) < Fixed::FromFloat(-1.5f));
+        EXPECT_TRUE(Fixed::FromFloat(0.5f) > Fixed());
+    } END
+
+    TEST(Fixed, Arithmetic) {
+        Fixed a = Fixed::FromFloat(1.5f), b = Fixed::FromFloat(2.25f);
+        EXPECT_FLOAT_EQ(3.75f, (a + b).ToFloat());
+        EXPECT_FLOAT_EQ(-0.75f, (a - b).ToFloat());
+        EXPECT_FLOAT_EQ(3.375f, (a * b).ToFloat());
+        EXPECT_FLOAT_EQ(-3.375f, (-a * b).ToFloat());
+        EXPECT_FLOAT_EQ(1.5f, (Fixed(3) / Fixed(2)).ToFloat());
+        EXPECT_FLOAT_EQ(-0.5f, (-Fixed::FromFloat(1.5f) / Fixed(3)).ToFloat());
+
+        a += b;
+        EXPECT_FLOAT_EQ(3.75f, a.ToFloat());
+        a -= Fixed(4);
+        EXPECT_FLOAT_EQ(-0.25f, a.ToFloat());
+    } END
+
+    // The sum does not depend on the order of the additions (unlike float)
+    TEST(Fixed, Accumulation) {
+        Fixed step = Fixed::FromFloat(0.1f), sum;
+        for (int i = 0; i < 1000; ++i)
+            sum += step;
+        EXPECT_EQ(step.Raw() * 1000, sum.Raw());
+    } END
+}
@@ -0,0 +1,118 @@
+/** @file FramePacer.h
+  * @brief Contains class FramePacer, which ends every frame on an even schedule.
+  *
+  * The frames are scheduled on the steady (performance counter) clock: every
+  * frame has a deadline one period after the previous one, so the rounding of
+  * a single wait does not add up. Waiting sleeps for the bulk of the time, then
+  * spins for the last fraction of a millisecond, because the scheduler may
+  * wake a sleeping thread a millisecond (or more) late. If the frames are
+  * locked to vsync, presenting a frame already waits for the display, so only
+  * the frames that were not presented (or were presented too early) are paced.
+  *
+  * The pacing error of every frame (how far its end was from the ideal one) is
+  * recorded in a histogram. Run the game with --pacing-report to print it at exit.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Paces the frames to a fixed period, and records the pacing error.
+ */
+class FramePacer {
+public:
+    typedef std::chrono::steady_clock Clock;    ///< Clock of the schedule.
+    static const std::vector<double> bucketLimits;  ///< Static member: upper limits of the buckets of the histogram in milliseconds (the last bucket has no limit).
+
+private:
+    Clock::duration period;     ///< Duration of a frame.
+    Clock::duration spinMargin; ///< The last part of the wait that is spun instead of slept.
+    bool isVsync;   ///< Contains whether presenting a frame waits for the display.
+    bool isStarted; ///< Contains whether the first frame has ended (the schedule starts there).
+    Clock::time_point deadline;     ///< Ideal end of the last frame.
+    Clock::time_point lastFrame;    ///< Actual end of the last frame.
+    std::vector<std::uint64_t> histogram;   ///< Number of frames per pacing error bucket (see bucketLimits).
+    std::uint64_t missedFrames; ///< Number of frames that ended more than a period late (the schedule restarts from them).
+    double maxError;    ///< Largest pacing error in milliseconds.
+
+    /**
+     * @brief Sleeps until shortly before the deadline, then spins until the deadline.
+     * @param time The deadline.
+     */
+    void WaitUntil(Clock::time_point time) const;
+
+public:
+    /**
+     * @brief Creates a pacer.
+     * @param periodMs Duration of a frame in milliseconds.
+     * @param isVsync Contains whether presenting a frame waits for the display.
+     * @param spinMarginMs The last part of every wait that is spun instead of slept, in milliseconds.
+     */
+    FramePacer(double periodMs = 10.0, bool isVsync = false, double spinMarginMs = 1.0);
+
+    /**
+     * @brief Changes the period (the schedule starts again from the next frame).
+     * @param periodMs Duration of a frame in milliseconds.
+     * @param isVsync Contains whether presenting a frame waits for the display.
+     */
+    void SetPeriod(double periodMs, bool isVsync);
+
+    /**
+     * @brief Ends the frame: waits until its deadline, and records the pacing error.
+     * @param isPresented Contains whether the frame has been presented (only a presented frame has waited for vsync).
+     * @return Returns whether the frame has been paced (false if vsync has already ended it, or it is late or the first one).
+     */
+    bool Wait(bool isPresented = true);
+
+    /**
+     * @brief Starts the schedule again from now (e.g. after waiting for events, which is not a late frame).
+     */
+    void Restart();
+
+    /**
+     * @brief Records the pacing error of a frame.
+     * @param errorMs Distance of the end of the frame from its ideal end in milliseconds.
+     */
+    void Record(double errorMs);
+
+    /**
+     * @return Returns the number of frames per pacing error bucket (see bucketLimits).
+     */
+    const std::vector<std::uint64_t>& GetHistogram() const;
+
+    /**
+     * @return Returns the number of recorded frames.
+     */
+    std::uint64_t GetFrameCount() const;
+
+    /**
+     * @return Returns the number of frames that ended more than a period late.
+     */
+    std::uint64_t GetMissedFrames() const;
+
+    /**
+     * @return Returns the largest pacing error in milliseconds.
+     */
+    double GetMaxError() const;
+
+    /**
+     * @brief Prints the histogram of the pacing error.
+     * @param os Output stream.
+     */
+    void Report(std::ostream& os) const;
+
+    /**
+     * @brief Destructor.
+     */
+    ~FramePacer();
+};
+
+#endif // FRAME_PACER_H
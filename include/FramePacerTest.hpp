@@ -0,0 +1,72 @@
+/** @file FramePacerTest.hpp
+  * @brief This file contains tests for the module FramePacer
+  *
+  * For testing, it uses the gtest_lite.h library.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+# include <iostream>
+# include <sstream>
+# include <string>
+# include <vector>
+# include <thread>
+# include <chrono>
+
+#include "gtest_lite.h"
+#include "FramePacer.h"
+
+void TEST_FramePacer() {
+    typedef FramePacer::Clock Clock;
+
+    /***** Checking the Histogram *****/
+
+    // Checks whether the pacing errors are counted in the right buckets
+    TEST(FramePacer, Histogram) {
+        FramePacer pacer;
+        pacer.Record(0.05);
+        pacer.Record(-0.3);
+        pacer.Record(1.5);
+        pacer.Record(10.0);
+
+        const std::vector<std::uint64_t>& histogram = pacer.GetHistogram();
+        EXPECT_EQ(FramePacer::bucketLimits.size() + 1, histogram.size());
+        EXPECT_EQ((std::uint64_t) 1, histogram[0]);
+        EXPECT_EQ((std::uint64_t) 1, histogram[2]);
+        EXPECT_EQ((std::uint64_t) 1, histogram[4]);
+        EXPECT_EQ((std::uint64_t) 1, histogram.back());
+        EXPECT_EQ((std::uint64_t) 4, pacer.GetFrameCount());
+        EXPECT_DOUBLE_EQ(10.0, pacer.GetMaxError());
+
+        std::stringstream report;
+        pacer.Report(report);
+        EXPECT_NE(std::string::npos, report.str().find("4 frames, 0 missed"));
+    } END
+
+    /***** Checking the Schedule *****/
+
+    // Checks whether no frame ends before its deadline, so the frames take at least their periods together
+    TEST(FramePacer, Schedule) {
+        FramePacer pacer(5.0);
+        pacer.Wait();
+        Clock::time_point start = Clock::now();
+        for (int i = 0; i < 10; ++i)
+            pacer.Wait();
+        double elapsed = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        EXPECT_TRUE(elapsed >= 49.0);
+        EXPECT_EQ((std::uint64_t) 10, pacer.GetFrameCount());
+    } END
+
+    // Checks whether a frame that has waited for vsync is not delayed again, but one presented too early is
+    // (the period is long, so the decisions do not depend on how fast the test runs)
+    TEST(FramePacer, Vsync) {
+        FramePacer pacer(100.0, true);
+        EXPECT_FALSE(pacer.Wait());
+        std::this_thread::sleep_for(std::chrono::milliseconds(60));
+        EXPECT_FALSE(pacer.Wait(true));
+        EXPECT_TRUE(pacer.Wait(true));
+        EXPECT_EQ((std::uint64_t) 2, pacer.GetFrameCount());
+    } END
+}
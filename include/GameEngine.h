@@ -19,9 +19,13 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <deque>
+#include <functional>
+#include <memory_resource>
 
 #include "RenderWindow.h"
 #include "Level.h"
+#include "World.h"
 #include "GameObject.h"
 #include "Texture.h"
 #include "RigidBody.h"
@@ -32,8 +36,22 @@
 #include "Timer.h"
 #include "Input.h"
 #include "Sound.h"
-
-#define FPS 100
+#include "LevelWatcher.h"
+#include "LatencyProbe.h"
+#include "Arena.h"
+#include "Assets.h"
+#include "ImageLoader.h"
+#include "PerformanceConfig.h"
+#include "LevelRegistry.h"
+#include "FramePacer.h"
+
+#ifndef JUMP_BUFFER
+#define JUMP_BUFFER 100 ///< A jump pressed at most this many milliseconds before landing is not lost.
+#endif
+
+#ifndef COYOTE_TIME
+#define COYOTE_TIME 80  ///< The player can still jump for this many milliseconds after leaving the ground.
+#endif
 
 namespace Scene {
     enum Type { NONE=0, TITLE, MENU, GAME, DEATH, LOAD };   ///< Type of the Scene.
@@ -59,30 +77,70 @@ std::ostream& operator<<(std::ostream& os, Scene::Type scene);
 class GameEngine {
 public:
     static RenderWindow* window;    ///< Static member, pointer to the window.
-    const static int frameDelay;    ///< Static member, contains the frame delay.
+    static int frameDelay;  ///< Static member, contains the frame delay (the duration of an update cycle rounded to milliseconds).
+    static float frameStep; ///< Static member, contains the duration of an update cycle in milliseconds (the fixed time step of the level, it does not depend on the display).
     static int frameTime;   ///< Static member, contains the frameTime.
 private:
+    static const size_t maxQuoteLength; ///< Static member: memory reserved for the caption of the quote button in bytes.
+    static const int maxUpdateCycles;   ///< Static member: most update cycles in a single frame (a longer frame, e.g. after a pause, is not caught up).
+    static const int idleTimeout;   ///< Static member: longest wait for an event in milliseconds when nothing is animating (the music is still updated this often).
+    static const size_t levelColumns;   ///< Static member: number of level buttons in a row of the menu.
+    static const size_t levelsPerPage;  ///< Static member: number of level buttons on a page of the menu.
     bool anyKeyPressed; ///< Contains whether any keys were pressed in a single update session.
     Transition transition;      ///< Contains transition module for transitions between scenes.
     std::unique_ptr<Level> level;   ///< Pointer to the loaded level (nullptr if no level is loaded).
-    Level::Type currentLevel;   ///< Contains the type of the current level.
-    Level::Type nextLevel;      ///< Contains the type of the next level.
-    Level::Type completedLevels;    ///< Contains the maximum completed levels.
+    std::unique_ptr<LevelRegistry> levels;  ///< Index of the levels in the order of the manifest (nullptr until it is loaded).
+    size_t currentLevel;    ///< Contains the index of the current level (LevelRegistry::none if no level is played).
+    size_t nextLevel;       ///< Contains the index of the next level (LevelRegistry::none if no level is loaded next).
+    size_t completedLevels; ///< Contains the number of levels completed in the order of the manifest (the next one is unlocked).
+    size_t levelPage;       ///< Contains the page of the level buttons shown in the menu.
     bool exitProgram;   ///< Contains whether the program is exited.
     bool isPaused;      ///< Contains whether the program is paused.
+    bool isMinimized;   ///< Contains whether the window is minimized (nothing is rendered).
+    bool isRedrawNeeded;    ///< Contains whether the current frame has to be rendered (an idle frame without events is not).
+    SDL_Texture* pausedFrame;   ///< The level as it was when the game was paused (nullptr if it is not paused or not drawn yet).
     Scene::Type currentScene;   ///< Contains the type of the current scene.
     Scene::Type nextScene;      ///< Contains the type of the next scene.
     Language currentLanguage;   ///< Contains the type of the current language.
-    std::vector<LanguageModule*> LangMod;   ///< Contains the loaded language modules.
+    std::vector<std::unique_ptr<LanguageModule>> LangMod;   ///< Contains the language modules (nullptr until a language is first used).
     TextButton* titleButton;    ///< Title button (caption).
     TextButton* deathButton;    ///< Death button (counter).
     std::vector<Button*> menuButtons;   ///< Contains all the menu buttons.
     std::vector<Button*> gameButtons;   ///< Contains all the game buttons.
+    std::vector<TextButton*> levelButtons;  ///< The level buttons of a page (reused for every page), then the previous and the next page button.
+    ImageLoader images; ///< Decodes the images of the menu and the levels on worker threads.
     Sound sounds;   ///< Contains all the loaded sounds.
     Texture titleScreen;    ///< Contains the texture of the title screen.
     Texture menuScreen;     ///< Contains the texture of the menu screen.
-    Input input;    ///< Contains the input booleans.
+    Input input;    ///< Contains the input booleans and the queued events of the moving keys.
     Uint32 frameStart;  ///< Contains the frame start of each update session.
+    Arena scratch;      ///< Memory of the transient data of a single frame (released at the beginning of every frame).
+    /**
+     * @brief A piece of the startup that is not needed for the title screen.
+     */
+    struct StartupTask {
+        const char* name;           ///< Name of the task in the startup report.
+        std::function<void()> run;  ///< Loads the piece (on the main thread).
+    };
+    std::deque<StartupTask> startupTasks;   ///< Pieces of the startup that are run in the idle time of the frames of the title screen.
+    bool isTitleShown;          ///< Contains whether the first frame of the title screen has been presented.
+    bool isStartupFinished;     ///< Contains whether the startup is finished (the queued pieces and the background loaders are done).
+    bool printStartupReport;    ///< Contains whether the startup report is printed when the startup is finished (--startup-report).
+    FramePacer pacer;   ///< Ends the frames on an even schedule (or on the vsync of the display).
+    bool printPacingReport;     ///< Contains whether the histogram of the pacing error is printed at exit (--pacing-report).
+    bool isVsync;       ///< Contains whether the frames are locked to the vertical sync of the display (a frame may take any number of update cycles).
+    double updateLag;   ///< Time in milliseconds that has passed, but has not been simulated yet (only used with vsync).
+    Uint32 lastUpdate;  ///< Start of the frame in which the update cycles were last counted.
+    #ifdef LATENCY
+    LatencyProbe latency;   ///< Measures the time from the input events to the presentation of the frames reflecting them.
+    #endif
+    #ifdef ALLOC_TRACK
+    bool assertNoAlloc = false; ///< Contains whether the program exits when the steady-state game allocates (--assert-no-alloc).
+    int steadyFrames = 0;   ///< Number of frames since the game has been in steady state (no transition and no pause).
+    #endif
+    #ifdef HOT_RELOAD
+    LevelWatcher levelWatcher;  ///< Watches the config file of the loaded level (reloads it when it is saved).
+    #endif
 
     /****************************************************************************************/
 
@@ -101,6 +159,44 @@ private:
      */
     void RenderPause();
 
+    /**
+     * @brief Renders the paused game: the level is drawn into a texture only once, then the texture is copied.
+     */
+    void RenderPausedFrame();
+
+    /**
+     * @brief Destroys the texture of the paused level (e.g. when the language of the quote changes), so it is drawn again.
+     */
+    void FreePausedFrame();
+
+    /**
+     * @return Returns whether nothing is animating (title, menu, or paused game without a transition),
+     * so the program can wait for the events instead of rendering the same frame again.
+     */
+    bool IsIdle() const;
+
+    /****************************************************************************************/
+
+    /**
+     * @brief Updates the caption of the death counter (its text is built in the scratch arena).
+     */
+    void UpdateDeathCaption();
+
+    /**
+     * @brief Queues the pieces of the startup that are not needed for the title screen (the menu and the game buttons).
+     */
+    void QueueStartupTasks();
+
+    /**
+     * @brief Runs a single queued piece of the startup.
+     */
+    void RunStartupTask();
+
+    /**
+     * @brief Runs every queued piece of the startup (called when the menu is needed).
+     */
+    void FinishStartupTasks();
+
     /****************************************************************************************/
 
     /**
@@ -153,10 +249,52 @@ private:
      */
     void UpdateSingeButton(Button* button);
 
+    /**
+     * @brief Loads the language on first use (mapped from the cache of compiled string tables).
+     * @param language The language.
+     * @return Returns the language module.
+     * @see LanguageModule
+     */
+    LanguageModule& GetLanguageModule(Language language);
+
     /****************************************************************************************/
 
     /**
-     * @brief Loads the (next) level.
+     * @brief Loads the index of the levels from the manifest (see LevelRegistry).
+     * @param isRebuilt Contains whether the manifest is scanned even if the cached index is valid (a level has changed since it was cached).
+     */
+    void LoadLevelRegistry(bool isRebuilt = false);
+
+    /**
+     * @brief Creates the level buttons of a page and the page buttons.
+     */
+    void CreateLevelButtons();
+
+    /**
+     * @brief Updates the captions of the level buttons to the levels of the current page.
+     */
+    void UpdateLevelButtons();
+
+    /**
+     * @param slot Index of the button in levelButtons.
+     * @return Returns whether the button is shown on the current page.
+     */
+    bool IsLevelButtonShown(size_t slot) const;
+
+    /**
+     * @param index Index of the level.
+     * @return Returns the caption of the level: its name, or its number if it has no name.
+     */
+    std::string GetLevelCaption(size_t index);
+
+    /**
+     * @brief Starts the given level if it is unlocked, otherwise an error sound is played.
+     * @param index Index of the level.
+     */
+    void StartLevel(size_t index);
+
+    /**
+     * @brief Loads the (next) level. If the level has changed since the index was cached, the index is rebuilt first.
      * @see nextLevel
      */
     void LoadLevel();
@@ -197,7 +335,7 @@ private:
     void StopSounds();
 
     /**
-     * @brief Loads all the necessary sounds for the program.
+     * @brief Requests all the necessary sounds for the program (they are loaded in the background).
      * @see Sound
      */
     void LoadSounds();
@@ -217,19 +355,15 @@ private:
     bool CheckIfLevelCompleted();
 
     /**
-     * @brief Checks whether a game object dies.
-     */
-    void CheckForDeath();
-
-    /**
-     * @brief Checks whether an entity collides with a game object.
+     * @return Returns the keys that move the player in the current update cycle.
      */
-    void CheckForCollision();
+    PlayerInput GetPlayerInput() const;
 
     /**
-     * @brief Checks whether an animations need to be played.
+     * @brief Plays the sounds and animations of the events that happened in the level, then clears the events.
+     * @see LevelEvent
      */
-    void CheckForAnimation();
+    void HandleLevelEvents();
 
     /****************************************************************************************/
 
@@ -238,11 +372,6 @@ private:
      */
     void AssignQuote();
 
-    /**
-     * @brief Recovers the player's position if its collision cannot be handled properly.
-     */
-    void RecoverPosition();
-
     /**
      * @brief Updates all the game objects' rectangles. Necessary for rendering them in the correct place on the screen.
      */
@@ -258,13 +387,21 @@ private:
      */
     int GetTransparency();
 
+    /**
+     * @brief Counts the update cycles of the frame. Without vsync it is always one (the pacer ends the frame one cycle later),
+     * locked to vsync it is the number of fixed time steps that have passed since the previous frame.
+     * @return Returns the number of update cycles to simulate in this frame.
+     */
+    int GetUpdateCycles();
+
 public:
     /**
      * @brief Creates a game engine and initialises its components.
      * @param window Reference to the window of the program. Necessary for accessing window and its components.
+     * @param config Performance settings (update rate, audio buffer, voices, decoder threads).
      * @see RenderWindow
      */
-    GameEngine(RenderWindow& window);
+    GameEngine(RenderWindow& window, const PerformanceConfig& config = PerformanceConfig());
 
     /**
      * @brief Ensures even FPS and update frequency.
@@ -272,11 +409,56 @@ public:
     void ApplyEvenFPS();
 
     /**
-     * @brief Handles all the events one-by-one.
+     * @brief Runs the queued pieces of the startup in the idle time of the frame (at least one, then while the first
+     * half of the frame lasts). Called after the frame has been presented. When the startup is finished, the startup report is printed if it was asked for.
+     * @see StartupReport
+     */
+    void LoadIncrementally();
+
+    /**
+     * @brief Sets whether the startup report is printed when the startup is finished.
+     * @param enabled Contains whether the report is printed.
+     */
+    void SetStartupReport(bool enabled);
+
+    /**
+     * @brief Sets whether the histogram of the pacing error is printed at exit.
+     * @param enabled Contains whether the report is printed.
+     */
+    void SetPacingReport(bool enabled);
+
+    #ifdef LATENCY
+    /**
+     * @brief Records the latency of the input events handled in this frame (called after RenderWindow::Display).
+     */
+    void FramePresented();
+    #endif
+
+    #ifdef ALLOC_TRACK
+    /**
+     * @brief Sets whether the program exits when the steady-state game allocates.
+     * @param enabled Contains whether allocations are fatal.
+     */
+    void SetAssertNoAlloc(bool enabled);
+
+    /**
+     * @brief Checks the allocations of the frame (called at the end of the frame). In the steady-state game,
+     * after a few frames of warm-up, every allocation is reported (and it is fatal with --assert-no-alloc).
+     */
+    void CheckAllocations();
+    #endif
+
+    /**
+     * @brief Handles all the events one-by-one. If nothing is animating, it waits for the first event (at most for idleTimeout).
      * @see SDL_Event
      */
     void HandleEvents();
 
+    /**
+     * @return Returns whether the frame has to be rendered (not while the window is minimized, or in an idle frame without events).
+     */
+    bool IsRedrawNeeded() const;
+
     /**
      * @brief Manages what happens when the given keys are pressed and on which scenes.
      */
@@ -293,7 +475,7 @@ public:
     void UpdateButtons();
 
     /**
-     * @brief Manages one update cycle of the game including: updating position, resolving collision, and checking for death.
+     * @brief Manages the update cycles of the frame including: moving the player by the keys, updating position, resolving collision, and checking for death.
      */
     void UpdateGame();
 
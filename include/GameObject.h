@@ -22,6 +22,9 @@
 #include "Texture.h"
 #include "RigidBody.h"
 #include "RenderWindow.h"
+#include "World.h"
+#include "Components.h"
+#include "Arena.h"
 
 // Forward declaration
 class Entity;
@@ -33,7 +36,12 @@ class GameEngine;
 class GameObject {
 public:
     static RenderWindow* window;    ///< Static member, necessary for accessing information.
-    static SDL_Rect screen;         ///< Static member, represents how to screen is moved.
+
+    /**
+     * @return Returns how the screen is moved in the world that is bound to the current thread.
+     * @see World
+     */
+    static SDL_Rect& Screen();
 
     /**
      * @brief Checks whether the two rectangles intersect.
@@ -90,13 +98,13 @@ public:
     static bool JumpedOnHead(const SDL_Rect& player, const SDL_Rect& enemy);
 
 protected:
-    Texture texture;    ///< Texture of the GameObject.
-    SDL_Rect hitBox;    ///< Hitbox the GameObject.
-    bool isRemoved;     ///< Represents an object beeing destroyed.
+    Components* components; ///< Components of the world that the object belongs to.
+    size_t id;  ///< Index of the object's slot in the components.
 
 public:
     /**
-     * Creates a new GameObject with the given boxes and texture.
+     * Creates a new GameObject with the given boxes and texture in the world that is bound to the current thread.
+     * @param kind Kind of the object (necessary for the systems of the components).
      * @param hitBox Hitbox of the GameObject.
      * @param srcRect Source rectangle for the Texture.
      * @param destRect Destination rectangle for the Texture.
@@ -104,8 +112,18 @@ public:
      * @param isRemoved Represents an object beeing destroyed.
      * @see SDL_Rect
      * @see SDL_Texture
+     * @see Components
      */
-    GameObject(SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect, SDL_Texture* texture, bool isRemoved=false);
+    GameObject(ObjectKind::Kind kind, SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect, SDL_Texture* texture, bool isRemoved=false);
+
+    /**
+     * @brief Copy constructor: the copy refers to the same slot in the world that is bound to the current thread.
+     * Necessary for cloning a level, whose world already contains the copied components.
+     * @param other The copied object (it has to belong to another world).
+     */
+    GameObject(const GameObject& other);
+
+    GameObject& operator=(const GameObject&) = delete;
 
     /**
      * @brief Updates the object with delta time.
@@ -133,13 +151,47 @@ public:
      * @brief Returns the hitbox of the object as reference.
      * @return Reference to the hitbox of the object.
      */
-    virtual SDL_Rect& HitBox();
+    SDL_Rect& HitBox() { return components->GetTransform(id).hitBox; }
+
+    /**
+     * @return Returns the id of the object (its slot in the components).
+     */
+    size_t GetId() const { return id; }
+
+    /**
+     * @return Returns the sprite (texture) of the object.
+     */
+    Texture& Sprite() { return components->GetSprite(id); }
+
+    /**
+     * @return Returns the activation and flags component of the object.
+     */
+    Flags& GetFlags() { return components->GetFlags(id); }
+
+    /**
+     * @return Returns reference to the rigid body (entities, and level elements that move at a constant velocity).
+     */
+    RigidBody& GetRigidBody() { return components->GetRigidBody(id); }
 
     /**
      * @brief Updates the destination rectangles of the texture, so that they would fit correctly on the screen.
      */
     virtual void UpdateDestRect();
 
+    /**
+     * @brief Allocates the object from the arena of the level that is bound to the current thread (or from the heap).
+     * @param size Size of the object.
+     * @see Arena
+     * @return Returns the memory of the object.
+     */
+    static void* operator new(size_t size);
+
+    /**
+     * @brief Frees the memory of the object if it is on the heap (an arena is freed at once with its level).
+     * @param memory Memory of the object.
+     */
+    static void operator delete(void* memory);
+
     /**
      * @brief Virtual destructor.
      */
@@ -0,0 +1,147 @@
+/** @file GlyphAtlas.h
+  * @brief Contains class GlyphAtlas, which draws text from glyphs cached in textures.
+  *
+  * Every font (type and size) has its own atlas. A glyph is rasterized only
+  * once, when it is first needed, and it is packed into a page (a texture)
+  * row by row. A caption is laid out once into a list of quads (source and
+  * destination rectangles), so drawing it only copies rectangles of the pages,
+  * and changing a caption or the language never creates a surface or a texture
+  * (except when new glyphs have to be added to the atlas).
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#ifndef CPORTA
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+#include <iostream>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+
+/**
+ * @brief Cache of the glyphs of a single font.
+ */
+class GlyphAtlas {
+public:
+    /**
+     * @brief A glyph of a laid out text.
+     */
+    struct Quad {
+        size_t page;        ///< Index of the page containing the glyph.
+        SDL_Rect srcRect;   ///< Rectangle of the glyph on the page.
+        SDL_Rect destRect;  ///< Rectangle of the glyph relative to the top-left corner of the text.
+    };
+
+    /**
+     * @brief A laid out text (it stays valid as long as the atlas exists).
+     */
+    struct Layout {
+        std::vector<Quad> quads;    ///< Glyphs of the text.
+        int width = 0;              ///< Width of the text.
+        int height = 0;             ///< Height of the text.
+    };
+
+private:
+    /**
+     * @brief A glyph stored in the atlas.
+     */
+    struct Glyph {
+        size_t page;        ///< Index of the page containing the glyph.
+        SDL_Rect srcRect;   ///< Rectangle of the glyph on the page (empty for invisible glyphs).
+        int advance;        ///< Horizontal distance to the next glyph.
+    };
+
+    TTF_Font* font;     ///< The font of the atlas.
+    const int pageSize; ///< Width and height of a page.
+    std::vector<SDL_Texture*> pages;    ///< Textures containing the glyphs.
+    std::unordered_map<Uint32, Glyph> glyphs;   ///< The rasterized glyphs (key: Unicode code point).
+    int shelfX;         ///< x coordinate of the next glyph on the current row.
+    int shelfY;         ///< y coordinate of the current row.
+    int shelfHeight;    ///< Height of the current row.
+
+    /**
+     * @brief Returns the glyph, rasterizes and packs it first if it is not in the atlas.
+     * @param codepoint Unicode code point of the glyph.
+     * @param utf8 The glyph encoded in UTF-8.
+     * @return Returns the glyph.
+     */
+    const Glyph& GetGlyph(Uint32 codepoint, std::string_view utf8);
+
+    /**
+     * @brief Finds a place for a glyph on the current row, a new row or a new page.
+     * @param w Width of the glyph.
+     * @param h Height of the glyph.
+     * @param page Index of the page (output).
+     * @param rect Rectangle of the glyph (output).
+     * @return Returns false if the glyph does not fit on a page.
+     */
+    bool Pack(int w, int h, size_t& page, SDL_Rect& rect);
+
+public:
+    /**
+     * @brief Creates an empty atlas (the pages are created when they are first needed).
+     * @param font The font of the atlas.
+     * @param pageSize Width and height of a page.
+     */
+    GlyphAtlas(TTF_Font* font, int pageSize = 1024);
+
+    GlyphAtlas(const GlyphAtlas&) = delete;
+    GlyphAtlas& operator=(const GlyphAtlas&) = delete;
+
+    /**
+     * @brief Lays out a single line of text (the missing glyphs are added to the atlas).
+     * @param text The text in UTF-8.
+     * @return Returns the laid out text.
+     */
+    Layout Typeset(std::string_view text);
+
+    /**
+     * @brief Lays out a single line of text into an existing layout (its memory is reused, so typesetting again does not allocate).
+     * @param text The text in UTF-8.
+     * @param layout The laid out text.
+     */
+    void Typeset(std::string_view text, Layout& layout);
+
+    /**
+     * @brief Draws a laid out text.
+     * @param layout The text laid out by this atlas.
+     * @param x x coordinate of the text.
+     * @param y y coordinate of the text.
+     * @param colour Colour of the text.
+     */
+    void Draw(const Layout& layout, int x, int y, SDL_Color colour);
+
+    /**
+     * @brief Decodes the next code point of a UTF-8 string (invalid bytes are decoded as U+FFFD).
+     * @param text The string.
+     * @param index Index of the first byte of the code point, it is moved to the next one.
+     * @return Returns the code point.
+     */
+    static Uint32 NextCodepoint(std::string_view text, size_t& index);
+
+    /**
+     * @return Returns the number of glyphs in the atlas.
+     */
+    size_t GetGlyphCount() const;
+
+    /**
+     * @return Returns the number of pages.
+     */
+    size_t GetPageCount() const;
+
+    /**
+     * @brief Destructor: destroys the pages (it has to be called before the renderer is destroyed).
+     */
+    ~GlyphAtlas();
+};
+
+#endif // CPORTA
+
+#endif // GLYPH_ATLAS_H
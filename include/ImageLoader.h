@@ -0,0 +1,125 @@
+/** @file ImageLoader.h
+  * @brief Contains class ImageLoader, which decodes images on worker threads.
+  *
+  * Decoding (or mapping the decoded texture cache, see PixelCache) does not
+  * need the renderer, so it is done by a small pool of worker threads while the
+  * main thread is busy with something else. Only creating the textures (the
+  * upload) has to stay on the main thread, it is done by Texture when the image
+  * is first used. The decoded images are kept for the whole session, so the
+  * images of the levels are not decoded again whenever a level is loaded.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef IMAGE_LOADER_H
+#define IMAGE_LOADER_H
+
+#ifndef CPORTA
+
+#include <SDL2/SDL.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+
+#include "PixelCache.h"
+
+/**
+ * @brief Decodes the requested images on a pool of worker threads.
+ */
+class ImageLoader {
+public:
+    /**
+     * @brief A decoded image in the renderer's native pixel format.
+     */
+    struct Image {
+        int width = 0;      ///< Width of the image in pixels.
+        int height = 0;     ///< Height of the image in pixels.
+        int pitch = 0;      ///< Length of a row of pixels in bytes.
+        const void* pixels = nullptr;   ///< Pixels of the image (they point into the cache or the surface).
+        std::unique_ptr<PixelCache> cache;  ///< Mapped cache file (nullptr if the image has been decoded).
+        SDL_Surface* surface = nullptr;     ///< Decoded and converted surface (nullptr if the cache has been used).
+
+        Image() = default;
+        Image(const Image&) = delete;
+        Image& operator=(const Image&) = delete;
+
+        /**
+         * @brief Destructor: frees the surface.
+         */
+        ~Image();
+    };
+
+private:
+    Uint32 format;  ///< The renderer's native pixel format.
+    std::map<std::string, std::shared_ptr<const Image>> images;    ///< Decoded images (nullptr if decoding has failed).
+    std::map<std::string, bool> isDone;     ///< Contains whether the requested images have been decoded (or have failed).
+    std::deque<std::string> queue;  ///< Images waiting for a worker.
+    int busyWorkers;    ///< Number of workers decoding an image.
+    bool isStopping;    ///< Tells the workers to exit.
+    std::mutex mutex;   ///< Guards every member above (never held while decoding).
+    std::condition_variable wakeUp;     ///< Wakes up the workers when an image is requested.
+    std::condition_variable decoded;    ///< Wakes up the main thread when an image has been decoded.
+    std::vector<std::thread> workers;   ///< The worker threads.
+
+    /**
+     * @brief Main function of the worker threads.
+     * @param index Index of the worker (for the startup report).
+     */
+    void DecodeQueuedImages(int index);
+
+public:
+    /**
+     * @brief Starts the workers.
+     * @param format The renderer's native pixel format.
+     * @param paths Images that are requested right away (see Request).
+     * @param workerCount Number of worker threads (0: one less than the number of cores, at least 1 and at most 4).
+     */
+    ImageLoader(Uint32 format, const std::vector<std::string>& paths = {}, int workerCount = 0);
+
+    ImageLoader(const ImageLoader&) = delete;
+    ImageLoader& operator=(const ImageLoader&) = delete;
+
+    /**
+     * @brief Requests an image (a requested image is decoded only once).
+     * @param path Path to the image relative to res/ (see Assets).
+     */
+    void Request(const std::string& path);
+
+    /**
+     * @brief Gets a requested image, it waits for it if it is still being decoded.
+     * @param path Path to the image relative to res/ (see Assets).
+     * @return Returns the decoded image (nullptr if it has not been requested or decoding has failed).
+     */
+    std::shared_ptr<const Image> Get(const std::string& path);
+
+    /**
+     * @return Returns whether every requested image has been decoded.
+     */
+    bool IsIdle();
+
+    /**
+     * @brief Decodes an image on the calling thread: reads the decoded texture cache, or decodes the image and writes the cache.
+     * @param path Path to the image relative to res/ (see Assets).
+     * @param format The renderer's native pixel format.
+     * @see PixelCache
+     * @return Returns the decoded image (nullptr if it has failed).
+     */
+    static std::shared_ptr<const Image> Decode(const std::string& path, Uint32 format);
+
+    /**
+     * @brief Destructor: stops the workers (the images in the queue are not decoded).
+     */
+    ~ImageLoader();
+};
+
+#endif // CPORTA
+
+#endif // IMAGE_LOADER_H
@@ -1,5 +1,12 @@
 /** @file Input.h
   * @brief Stores the states of the keys.
+  *
+  * The keys that move the player are not sampled once per frame: their events
+  * are queued with the timestamps of SDL, and every update cycle consumes the
+  * queued events. A key that was pressed and released between two cycles still
+  * counts as pressed in the next cycle. A jump that is pressed shortly before
+  * the player lands is buffered, so it is not lost (see jump buffer).
+  *
   * @author Bácsi Miklós
   * @date 2025-05-18
 */
@@ -7,25 +14,78 @@
 #ifndef INPUT_H
 #define INPUT_H
 
+#include <cstdint>
+#include <cstddef>
+
 class Input {
+public:
+    enum Key { LEFT=0, RIGHT, UP, DOWN, KEY_COUNT };    ///< Keys that move the player.
+    static const size_t queueSize = 64; ///< Static member: capacity of the event queue (when it is full, the oldest event is applied right away).
+
+    /**
+     * @brief A press or a release of a key that moves the player.
+     */
+    struct Event {
+        Key key;        ///< The key.
+        bool pressed;   ///< Contains whether the key was pressed (or released).
+        std::uint32_t timestamp;    ///< Time of the event in milliseconds (see SDL_GetTicks).
+    };
+
 private:
     int MouseX; ///< Contains x coordinate of the mouse.
     int MouseY; ///< Contains y coordinate of the mouse.
     bool MouseClick;    ///< Contains whether the mouse is clicked.
     bool Esc;   ///< Contains key 'Esc' is pressed.
-    bool W;     ///< Contains key 'W' is pressed.
-    bool A;     ///< Contains key 'A' is pressed.
-    bool S;     ///< Contains key 'S' is pressed.
-    bool D;     ///< Contains key 'D' is pressed.
     bool P;     ///< Contains key 'P' is pressed.
     bool Space; ///< Contains key 'Space' is pressed.
     bool disableEsc;    ///< Contains whether the key 'Esc' is disabled (necessary for smooth input).
     bool disableP;      ///< Contains whether the key 'P' is disabled (necessary for smooth input).
+    Event events[queueSize];    ///< Events of the moving keys that have not been consumed yet (ring buffer, so queueing never allocates).
+    size_t firstEvent;          ///< Index of the oldest queued event.
+    size_t eventCount;          ///< Number of queued events.
+    bool held[KEY_COUNT];       ///< Contains whether the key is held down after the consumed events.
+    bool tapped[KEY_COUNT];     ///< Contains whether the key was pressed during the current update cycle.
+    std::uint32_t jumpBuffer;   ///< A jump stays pending for this many milliseconds after it was pressed.
+    bool jumpPending;           ///< Contains whether a jump was pressed, but the player has not jumped yet.
+    std::uint32_t jumpPressedAt;    ///< Time of the last press of the jump.
+
+    /**
+     * @brief Applies a consumed event to the state of the keys.
+     * @param event The event.
+     */
+    void Apply(const Event& event);
+
 public:
     /**
      * Constructor that initialises all boolean values to false.
+     * @param jumpBuffer A jump stays pending for this many milliseconds after it was pressed.
+     */
+    Input(std::uint32_t jumpBuffer = 0);
+
+    /**
+     * @brief Queues a press or a release of a key that moves the player.
+     * @param key The key.
+     * @param pressed Contains whether the key was pressed (or released).
+     * @param timestamp Time of the event in milliseconds.
+     */
+    void Push(Key key, bool pressed, std::uint32_t timestamp);
+
+    /**
+     * @brief Starts a new update cycle: applies the queued events up to the given time, and drops the expired jump.
+     * @param now Time of the update cycle in milliseconds.
+     */
+    void Consume(std::uint32_t now);
+
+    /**
+     * @brief Clears the pending jump (called when the player has jumped).
+     */
+    void ConsumeJump();
+
+    /**
+     * @param key The key.
+     * @return Returns whether the key is held down (regardless of the presses during the update cycle).
      */
-    Input();
+    bool IsHeld(Key key) const;
 
     /**
      * @return Returns the x coordinate of the mouse.
@@ -48,22 +108,22 @@ public:
     bool GetEsc() const;
 
     /**
-     * @return Returns whether the up is pressed.
+     * @return Returns whether the up is pressed (held, pressed during the update cycle or a pending jump).
      */
     bool GetUp() const;
 
     /**
-     * @return Returns whether the left is pressed.
+     * @return Returns whether the left is pressed (held or pressed during the update cycle).
      */
     bool GetLeft() const;
 
     /**
-     * @return Returns whether the down is pressed.
+     * @return Returns whether the down is pressed (held or pressed during the update cycle).
      */
     bool GetDown() const;
 
     /**
-     * @return Returns whether the right is pressed.
+     * @return Returns whether the right is pressed (held or pressed during the update cycle).
      */
     bool GetRight() const;
 
@@ -97,26 +157,6 @@ public:
      */
     void SetEsc(bool pressed);
 
-    /**
-     * @brief Sets the up state.
-     */
-    void SetW(bool pressed);
-
-    /**
-     * @brief Sets the left state.
-     */
-    void SetA(bool pressed);
-
-    /**
-     * @brief Sets the down state.
-     */
-    void SetS(bool pressed);
-
-    /**
-     * @brief Sets the right state.
-     */
-    void SetD(bool pressed);
-
     /**
      * @brief Sets the key 'P'.
      */
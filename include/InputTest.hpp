@@ -0,0 +1,81 @@
+/** @file InputTest.hpp
+  * @brief This file contains tests for the input queue of the module Input
+  *
+  * For testing, it uses the gtest_lite.h library.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+# include <iostream>
+
+#include "gtest_lite.h"
+#include "Input.h"
+
+void TEST_Input() {
+    /***** Checking the Queue *****/
+
+    // Checks whether a press and a release between two update cycles still counts in the next cycle
+    TEST(Input, Tap) {
+        Input input;
+        input.Push(Input::RIGHT, true, 101);
+        input.Push(Input::RIGHT, false, 104);
+        input.Consume(110);
+        EXPECT_TRUE(input.GetRight());
+        EXPECT_FALSE(input.IsHeld(Input::RIGHT));
+
+        input.Consume(120);
+        EXPECT_FALSE(input.GetRight());
+    } END
+
+    // Checks whether only the events until the time of the cycle are consumed
+    TEST(Input, Timestamps) {
+        Input input;
+        input.Push(Input::LEFT, true, 105);
+        input.Push(Input::LEFT, false, 115);
+        input.Consume(110);
+        EXPECT_TRUE(input.IsHeld(Input::LEFT));
+        input.Consume(120);
+        EXPECT_FALSE(input.IsHeld(Input::LEFT));
+        EXPECT_FALSE(input.GetLeft());
+    } END
+
+    // Checks whether the oldest events are applied when the queue is full, so the last state of the keys is kept
+    TEST(Input, Overflow) {
+        Input input;
+        for (size_t i = 0; i <= Input::queueSize; ++i)
+            input.Push(Input::LEFT, i % 2 == 0, 100 + (std::uint32_t) i);
+        input.Push(Input::RIGHT, true, 200);
+        input.Consume(300);
+        EXPECT_TRUE(input.IsHeld(Input::LEFT));
+        EXPECT_TRUE(input.IsHeld(Input::RIGHT));
+    } END
+
+    /***** Checking the Jump Buffer *****/
+
+    // Checks whether a jump stays pending within the buffer, and expires after it
+    TEST(Input, JumpBuffer) {
+        Input input(30);
+        input.Push(Input::UP, true, 100);
+        input.Push(Input::UP, false, 102);
+        input.Consume(110);
+        input.Consume(120);
+        EXPECT_TRUE(input.GetUp());
+        input.Consume(130);
+        EXPECT_TRUE(input.GetUp());
+        input.Consume(140);
+        EXPECT_FALSE(input.GetUp());
+    } END
+
+    // Checks whether the pending jump is cleared when the player jumps
+    TEST(Input, ConsumeJump) {
+        Input input(30);
+        input.Push(Input::UP, true, 100);
+        input.Consume(110);
+        input.ConsumeJump();
+        EXPECT_TRUE(input.GetUp());     // still held
+        input.Push(Input::UP, false, 112);
+        input.Consume(120);
+        EXPECT_FALSE(input.GetUp());
+    } END
+}
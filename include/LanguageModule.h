@@ -1,5 +1,17 @@
 /** @file LanguageModule.h
-  * @brief Stores translation of captions and quotes in a single language. 
+  * @brief Stores translation of captions and quotes in a single language.
+  *
+  * The text file of a language is compiled into a string table: a header,
+  * an index of offsets and the null-terminated strings one after another.
+  * Lookups return views into the table, so they never allocate. The compiled
+  * table is cached (see PixelCache), so a language is only mapped into memory
+  * when it is first used.
+  *
+  * Layout of the string table (native byte order):
+  * - Header: magic "CMLS", version, number of captions, number of quotes.
+  * - Index: captionCount + quoteCount + 1 offsets of the strings (relative to the first string).
+  * - Strings: the captions followed by the quotes, each terminated by '\0'.
+  *
   * @author Bácsi Miklós
   * @date 2025-05-18
 */
@@ -9,11 +21,16 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
+#include <memory>
 #include <fstream>
 #include <sstream>
 #include <random>
 #include <ctime>
+#include <cstdint>
+
+#include "PixelCache.h"
 
 enum Language { ENGLISH=0, JAPANESE, HUNGARIAN };   ///< Included languages.
 
@@ -21,11 +38,33 @@ namespace Lang {
     enum CaptionType { PRESS=0, START, EXIT_TO_MENU, PAUSE, CONTINUE, LVL1, LVL2, CAT_MARIO, NONE };    ///< Included caption types.
 }
 
-/** 
+/**
+ * @brief View of a null-terminated string (c_str() can be passed to C functions, e.g. SDL_ttf).
+ */
+class CStringView : public std::string_view {
+public:
+    /**
+     * @brief Creates a view of an empty string.
+     */
+    CStringView();
+
+    /**
+     * @param data Beginning of the string (data[length] must be '\0').
+     * @param length Length of the string.
+     */
+    CStringView(const char* data, size_t length);
+
+    /**
+     * @return Returns the null-terminated string.
+     */
+    const char* c_str() const;
+};
+
+/**
  * @brief Single quote (necessary for translation when changing language).
  */
 struct Quote {
-    std::string quote;  ///< Caption of the quote.
+    CStringView quote;  ///< Caption of the quote (points into the string table of the language).
     size_t quoteIndex;  ///< Index of the quote.
 };
 
@@ -33,18 +72,77 @@ struct Quote {
  * @brief Contains all the translations of a single language.
  */
 class LanguageModule {
+public:
+    static const std::uint32_t version;     ///< Static member: version of the string table format.
+
+    /**
+     * @brief Header at the beginning of the string table.
+     */
+    struct Header {
+        char magic[4];              ///< Always "CMLS".
+        std::uint32_t version;      ///< Version of the string table format.
+        std::uint32_t captionCount; ///< Number of captions.
+        std::uint32_t quoteCount;   ///< Number of quotes.
+    };
+
 private:
-    std::vector<std::string> captions;  ///< Contains the translations of the captions.
-    std::vector<Quote> quotes;  ///< Contains the translated quotes.
+    std::string compiled;   ///< The string table if it is compiled in memory (empty if it is mapped).
+    std::unique_ptr<PixelCache> mapping;    ///< The mapped cache file if the string table is read from the cache.
+    const Header* header;   ///< Header of the string table.
+    const std::uint32_t* offsets;   ///< Index of the string table.
+    const char* strings;    ///< Beginning of the strings.
+
+    /**
+     * @brief Creates a language module without a string table (see Load).
+     */
+    LanguageModule();
+
+    /**
+     * @brief Checks the string table, and sets the pointers into it.
+     * @param table The string table.
+     * @return Returns false if the table is corrupted.
+     */
+    bool Attach(std::string_view table);
+
+    /**
+     * @param index Index of the string in the table.
+     * @return Returns the string.
+     */
+    CStringView String(size_t index) const;
+
 public:
     /**
-     * Creates a new GameObject with the given boxes and texture.
+     * Creates a new LanguageModule from a text file.
      * @param path Path to the file containing the translations.
-     * @param isRemoved Represents an object beeing destroyed.
      * @see Quote
      */
     LanguageModule(std::string path);
 
+    /**
+     * Creates a new LanguageModule from an already opened stream (e.g. an asset from the asset pack).
+     * @param file Input stream of the translations.
+     * @see Assets
+     */
+    LanguageModule(std::istream& file);
+
+    LanguageModule(const LanguageModule&) = delete;
+    LanguageModule& operator=(const LanguageModule&) = delete;
+
+    /**
+     * @brief Maps the compiled string table from the cache, or compiles the text and writes the cache first.
+     * @param source Contents of the text file of the language.
+     * @param cachePath Path to the cache file of the compiled string table.
+     * @return Returns the loaded language.
+     */
+    static std::unique_ptr<LanguageModule> Load(std::string_view source, const std::string& cachePath);
+
+    /**
+     * @brief Compiles the text of a language into a string table.
+     * @param file Input stream of the translations (the number of captions, the captions, the number of quotes, the quotes, one per line).
+     * @return Returns the string table.
+     */
+    static std::string Compile(std::istream& file);
+
     /**
      * @param index Index of the quote.
      * @see Quote
@@ -62,7 +160,7 @@ public:
      * @param caption Type of caption that should be translated.
      * @return Returns the translation of the caption.
      */
-    std::string GetTranslation(Lang::CaptionType caption) const;
+    CStringView GetTranslation(Lang::CaptionType caption) const;
 
     /**
      * Destructor.
@@ -70,4 +168,4 @@ public:
     ~LanguageModule();
 };
 
-#endif // LANGUAGE_MODULE_H
\ No newline at end of file
+#endif // LANGUAGE_MODULE_H
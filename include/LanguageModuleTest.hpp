@@ -8,6 +8,10 @@
 */
 
 # include <iostream>
+# include <fstream>
+# include <sstream>
+# include <string>
+# include <filesystem>
 
 #include "gtest_lite.h"
 #include "LanguageModule.h"
@@ -182,4 +186,40 @@ void TEST_LanguageModule() {
         LanguageModule hungarian("../res/lang/Hungarian.txt");
         EXPECT_STREQ("Macska Márió", hungarian.GetTranslation(Lang::CAT_MARIO).c_str());
     } END
-}
\ No newline at end of file
+
+    /***** Checking the String Table *****/
+
+    // Checks whether the lookups point into the null-terminated string table
+    TEST(StringTable, Views) {
+        LanguageModule english("../res/lang/English.txt");
+        CStringView start = english.GetTranslation(Lang::START);
+        EXPECT_EQ((size_t) 10, start.size());
+        EXPECT_EQ('\0', start.c_str()[start.size()]);
+        EXPECT_TRUE(english.GetQuote(0).quote.data() == english.GetQuote(0).quote.data());
+        EXPECT_STREQ(" ", english.GetTranslation(Lang::NONE).c_str());
+        EXPECT_THROW(english.GetQuote(COUNT), const std::out_of_range&);
+    } END
+
+    // Checks whether the compiled table is written to the cache, and the cache is read back unchanged
+    TEST(StringTable, Cache) {
+        const std::string cachePath = (std::filesystem::temp_directory_path() / "Cat-Mario-Test.lang").string();
+        std::filesystem::remove(cachePath);
+
+        std::ifstream file("../res/lang/Hungarian.txt");
+        std::stringstream source;
+        source << file.rdbuf();
+
+        std::unique_ptr<LanguageModule> compiled = LanguageModule::Load(source.str(), cachePath);
+        EXPECT_TRUE(std::filesystem::exists(cachePath));
+        std::unique_ptr<LanguageModule> mapped = LanguageModule::Load(source.str(), cachePath);
+        EXPECT_STREQ("1. Szint", mapped->GetTranslation(Lang::LVL1).c_str());
+        EXPECT_STREQ("Húúúúú, ez közel volt!", mapped->GetQuote(COUNT - 1).quote.c_str());
+        EXPECT_STREQ(compiled->GetQuote(42).quote.c_str(), mapped->GetQuote(42).quote.c_str());
+
+        // A changed source is compiled again
+        std::unique_ptr<LanguageModule> changed = LanguageModule::Load("1\nCaption\n1\nQuote\n", cachePath);
+        EXPECT_STREQ("Quote", changed->GetQuote(0).quote.c_str());
+        EXPECT_THROW(LanguageModule::Load("1\nCaption\n", cachePath), const std::runtime_error&);
+        std::filesystem::remove(cachePath);
+    } END
+}
@@ -0,0 +1,81 @@
+/** @file LatencyProbe.h
+  * @brief Contains class LatencyProbe, which measures the input-to-photon latency (compile with -DLATENCY).
+  *
+  * Every input event is tagged with its SDL timestamp. The update cycle that
+  * handles the event consumes it, and when the frame rendered after that cycle
+  * has been presented, the time since the event is recorded for the current
+  * scene. At exit, the distribution of the latencies (p50, p95, p99) is printed.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+
+/**
+ * @brief Tracks input events until the frame reflecting them is presented.
+ */
+class LatencyProbe {
+private:
+    std::vector<std::uint32_t> queued;      ///< Timestamps of the events that have not been handled by an update cycle yet.
+    std::vector<std::uint32_t> inFlight;    ///< Timestamps of the handled events whose frame has not been presented yet.
+    std::map<std::string, std::vector<std::uint32_t>> samples;  ///< Measured latencies in milliseconds (key: name of the scene).
+
+public:
+    /**
+     * @brief Default constructor.
+     */
+    LatencyProbe() = default;
+
+    /**
+     * @brief Tags an input event.
+     * @param timestamp Time of the event in milliseconds (see SDL_GetTicks).
+     */
+    void Tag(std::uint32_t timestamp);
+
+    /**
+     * @brief An update cycle handles the events tagged until the given time.
+     * @param now Time of the update cycle in milliseconds.
+     */
+    void Consume(std::uint32_t now);
+
+    /**
+     * @brief A frame has been presented: records the latencies of the handled events.
+     * @param now Time of the presentation in milliseconds.
+     * @param scene Name of the scene that was presented.
+     */
+    void Present(std::uint32_t now, const std::string& scene);
+
+    /**
+     * @param scene Name of the scene.
+     * @return Returns the number of latencies measured in the scene.
+     */
+    size_t GetSampleCount(const std::string& scene) const;
+
+    /**
+     * @param scene Name of the scene.
+     * @param percent Percentile between 0 and 100.
+     * @return Returns the percentile of the latencies measured in the scene (nearest rank, 0 if there are none).
+     */
+    std::uint32_t GetPercentile(const std::string& scene, double percent) const;
+
+    /**
+     * @brief Prints the number of samples, p50, p95, p99 and the maximum of every scene.
+     * @param os Output stream.
+     */
+    void Report(std::ostream& os) const;
+
+    /**
+     * @brief Destructor.
+     */
+    ~LatencyProbe();
+};
+
+#endif // LATENCY_PROBE_H
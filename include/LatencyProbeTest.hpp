@@ -0,0 +1,54 @@
+/** @file LatencyProbeTest.hpp
+  * @brief This file contains tests for the module LatencyProbe
+  *
+  * For testing, it uses the gtest_lite.h library.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+# include <iostream>
+# include <cstdint>
+
+#include "gtest_lite.h"
+#include "LatencyProbe.h"
+
+void TEST_LatencyProbe() {
+    /***** Checking the Tracking *****/
+
+    // Checks whether an event is only measured after the update cycle handling it, at the next presented frame
+    TEST(LatencyProbe, Tracking) {
+        LatencyProbe probe;
+        probe.Tag(100);
+        probe.Tag(112);
+        probe.Consume(110);
+        probe.Present(118, "GAME");
+        EXPECT_EQ((size_t) 1, probe.GetSampleCount("GAME"));
+        EXPECT_EQ((std::uint32_t) 18, probe.GetPercentile("GAME", 50));
+
+        probe.Present(128, "GAME");     // nothing new was handled
+        EXPECT_EQ((size_t) 1, probe.GetSampleCount("GAME"));
+
+        probe.Consume(120);
+        probe.Present(125, "MENU");
+        EXPECT_EQ((size_t) 1, probe.GetSampleCount("MENU"));
+        EXPECT_EQ((std::uint32_t) 13, probe.GetPercentile("MENU", 99));
+    } END
+
+    /***** Checking the Percentiles *****/
+
+    // Checks the nearest-rank percentiles
+    TEST(LatencyProbe, Percentiles) {
+        LatencyProbe probe;
+        for (std::uint32_t latency = 1; latency <= 100; ++latency) {
+            probe.Tag(1000 - latency);
+            probe.Consume(1000);
+            probe.Present(1000, "GAME");
+        }
+        EXPECT_EQ((std::uint32_t) 50, probe.GetPercentile("GAME", 50));
+        EXPECT_EQ((std::uint32_t) 95, probe.GetPercentile("GAME", 95));
+        EXPECT_EQ((std::uint32_t) 99, probe.GetPercentile("GAME", 99));
+        EXPECT_EQ((std::uint32_t) 100, probe.GetPercentile("GAME", 100));
+        EXPECT_EQ((std::uint32_t) 0, probe.GetPercentile("TITLE", 50));
+    } END
+}
@@ -21,6 +21,8 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <random>
 
 #include "RenderWindow.h"
 #include "GameObject.h"
@@ -29,7 +31,9 @@
 #include "Entity.h"
 #include "Block.h"
 #include "LevelElement.h"
-#include "CoinAnimation.h"
+#include "ParticleSystem.h"
+#include "World.h"
+#include "Arena.h"
 
 #define BLOCK_SIZE 30
 #define SCALED_BLOCK_SIZE 75
@@ -56,26 +60,182 @@ struct EnemyData {
     bool faceLeft;  ///< Contains whether enemy faces to the left (or up for certain LevelElement(s)).
 };
 
+namespace BlockType {
+    enum Type { NONE=0, UPPER_DIRT, LOWER_DIRT, BRICK, BOXY, HIDDEN, MYSTERY };  ///< Type of the block in a grid cell.
+}
+
+/**
+ * @brief Used for level config. A single enemy or level element as it is written in the config file.
+ */
+struct ObjectData {
+    std::string type;   ///< Name of the config section (e.g. "CommonEnemy" or "Cloud").
+    EnemyData data;     ///< Spawn point and activation (activation point and facing are unused for most level elements).
+
+    /**
+     * @param rhs The other object that we are comparing to.
+     * @return Returns whether all the members match.
+     */
+    bool operator==(const ObjectData& rhs) const;
+
+    /**
+     * @param rhs The other object that we are comparing to.
+     * @return Returns whether this object comes before the other one (necessary for matching objects when reloading).
+     */
+    bool operator<(const ObjectData& rhs) const;
+};
+
+/**
+ * @brief Used for level config. Contains everything that is read from the config file.
+ */
+struct LevelDefinition {
+    Coordinate gridSize;    ///< Width and height of the grid counted in blocks.
+    Coordinate player;      ///< Spawn point of the player.
+    std::vector<BlockType::Type> cells;     ///< Type of the block in every grid cell (flattened in a 1D array).
+    std::vector<ObjectData> enemies;    ///< Enemies in the same order as Level::enemies.
+    std::vector<ObjectData> elements;   ///< Level elements in the same order as Level::elements.
+};
+
+/**
+ * @brief The keys that move the player in a single update cycle.
+ */
+struct PlayerInput {
+    bool left = false;  ///< Contains whether the player moves to the left.
+    bool right = false; ///< Contains whether the player moves to the right.
+    bool up = false;    ///< Contains whether the player jumps.
+    bool down = false;  ///< Contains whether the down key is pressed (it cancels jumping).
+    bool upReleased = false;    ///< Contains whether the up key is not held any more (it cuts the jump short).
+};
+
+/**
+ * @brief Something that happened during a single update cycle of the level and needs to be played (sound or animation).
+ * The level only collects the events, so it can be simulated without audio (e.g. by LevelSolver).
+ */
+struct LevelEvent {
+    enum Type { JUMP=0, COIN, BREAK, ROAR, POP, FISH, LASER, FLAG };    ///< Type of the event.
+    Type type;  ///< Type of the event.
+    int x;      ///< x coordinate where the event happened.
+    int y;      ///< y coordinate where the event happened.
+};
+
+/**
+ * @brief An enemy or a level element waiting for the player to reach its activation point.
+ */
+struct Activation {
+    int position;   ///< The player's position where the object is activated.
+    bool isEnemy;   ///< Contains whether the object is stored in Level::enemies (or in Level::elements).
+    size_t index;   ///< Index of the object in its container.
+};
+
 /**
  * @brief A single game level that contains all the entities, block and level elements.
  */
 class Level {
     friend class GameEngine;
-public:
-    enum Type { NONE=0, LVL1, LVL2 };   ///< Type of the level.
-    static bool isCompleted;    ///< Contains whether the level has been completed.
-
 private:
+    static int textureUsers;    ///< Static member: number of levels using the shared textures of Entity, Block and LevelElement.
+    static std::mutex textureMutex;     ///< Static member: guards loading and destroying the shared textures.
+    static const size_t arenaSize;      ///< Static member: size of the initial buffer of the arena of a loaded level in bytes.
+    Arena arena;    ///< Memory of all the game objects of the level (declared first, so it is destroyed after them).
+    World world;    ///< Simulation state of the level (bound to the thread that updates the level).
     std::unique_ptr<Player> player; ///< Pointer to the player.
     std::vector<std::unique_ptr<Enemy>> enemies;    ///< Stores "default" enemies using heterogeneous collection.
-    std::vector<std::unique_ptr<Enemy>> tempEnemies;    ///< Stores enemies created by MysteryBlock(s). Uses heterogeneous collection, and clear the container on every reset.
+    std::vector<std::unique_ptr<Enemy>> tempEnemies;    ///< Stores enemies created by MysteryBlock(s). Uses heterogeneous collection, and the enemies are moved to the pools on every reset.
+    std::vector<std::unique_ptr<Enemy>> enemyPools[EnemyType::COUNT];  ///< Removed temporary enemies of each type waiting to be spawned again (so spawning does not allocate).
     Grid grid;  ///< Contains the blocks using heterogeneous collection. Empty blocks are stored as nullptr(s).
     std::vector<std::unique_ptr<LevelElement>> elements;    ///< Stores level elements using heterogeneous collection.
-    CoinAnimation animation;    ///< Stores coins used for animation.
+    ParticleSystem particles;   ///< Coins, brick debris, enemy pops and laser trails.
+    float coyoteTime;   ///< The player can still jump for this many milliseconds after leaving the ground.
     Quote quote;    ///< Stores a quote for the active enemy chosen to display it.
     Enemy* enemyWithQuote;  ///< Pointer to the enemy chosen to have the quote. Value is nullptr if there is no suitable enemy for the role.
-    std::unique_ptr<TextButton> quoteButton;    ///< Pointer to the quote's button that a single, chosen enemy has.
+    std::unique_ptr<TextButton> quoteButton;    ///< Pointer to the quote's button that a single, chosen enemy has. It is created with the level and reused for every quote (only drawn while there is an enemy with the quote).
     int maxCameraX; ///< Contains the limit of the camera that it cannot move beyond.
+    std::string configFile;     ///< Path to the config file that the level is loaded from.
+    std::shared_ptr<const LevelDefinition> definition;  ///< The currently loaded config (necessary for patching the level when reloading). Shared by the clones of the level.
+    std::mt19937 random;    ///< Random generator of the spawns of MysteryBlock(s). Seedable, so a simulation can be replayed.
+    std::vector<LevelEvent> events; ///< Events of the last update cycle that have not been handled yet.
+    std::vector<Activation> activationQueue;    ///< Inactive enemies and level elements sorted by their activation point.
+    size_t nextActivation;  ///< Index of the first object in the queue that has not been activated yet.
+    std::vector<size_t> activeEnemies;  ///< Indices of the activated, not removed enemies in ascending order (only these are updated).
+    std::vector<size_t> activeElements; ///< Indices of the activated, not removed level elements in ascending order.
+    std::vector<size_t> enemyIds;   ///< Component ids of the active enemies and the temporary ones (a dense list for the systems, collected in every update cycle).
+    std::vector<size_t> visibleIds; ///< Component ids of the visible blocks, the active level elements, the player and the enemies of enemyIds.
+
+    /****************************************************************************************/
+
+    /**
+     * @brief Copy constructor: clones every game object with its current state. The clone has no particles and no quote.
+     * @param other The level that is cloned.
+     */
+    Level(const Level& other);
+
+    /**
+     * @brief Binds the world and the arena of the level to the current thread (objects created after this are allocated from the arena).
+     */
+    void Bind();
+
+    /**
+     * @brief Checks whether a game object dies.
+     */
+    void CheckForDeath();
+
+    /**
+     * @brief Checks whether an entity collides with a game object.
+     * @param input Keys that move the player (necessary for slowing down the player when no key is pressed).
+     */
+    void CheckForCollision(const PlayerInput& input);
+
+    /**
+     * @brief Checks whether an animation or a sound needs to be played, and adds the appropriate events.
+     */
+    void CheckForAnimation();
+
+    /**
+     * @brief Recovers the player's position if its collision cannot be handled properly.
+     */
+    void RecoverPosition();
+
+    /**
+     * @brief Sorts the inactive enemies and level elements by their activation point, and collects the active ones.
+     * Necessary after loading, resetting or reloading the level.
+     */
+    void BuildActivationQueue();
+
+    /**
+     * @brief Activates the objects of the queue whose activation point the player has reached.
+     * Only these objects are checked, so it takes time proportional to the number of activations.
+     */
+    void ActivateObjects();
+
+    /**
+     * @brief Collects the component ids of the active enemies and the temporary ones into enemyIds.
+     */
+    void CollectEnemyIds();
+
+    /**
+     * @brief Collects the component ids of every object whose sprite may be on the screen into visibleIds
+     * (only the columns of the grid around the screen are visited, like in Grid::UpdateDestRect).
+     */
+    void CollectVisibleIds();
+
+    /**
+     * @param type Type of the event.
+     * @param x x coordinate where the event happened.
+     * @param y y coordinate where the event happened.
+     */
+    void AddEvent(LevelEvent::Type type, int x=0, int y=0);
+
+    /****************************************************************************************/
+
+    /**
+     * @brief Loads the shared textures of Entity, Block and LevelElement if this is the first level using them.
+     * Nothing is loaded for headless levels (when there is no renderer).
+     */
+    void AcquireTextures();
+
+    /**
+     * @brief Destroys the shared textures if this is the last level using them.
+     */
+    void ReleaseTextures();
 
     /****************************************************************************************/
 
@@ -140,54 +300,23 @@ private:
     /****************************************************************************************/
 
     /**
-     * @brief Adds a common enemy with the given parameters.
-     * @param x x coordinate of spawn point.
-     * @param y y coordinate of spawn point.
-     * @param activationPoint When the player reaches this x coordinate, the enemy gets activated.
-     * @param faceLeft Contains whether enemy faces left.
-     * @see CommonEnemy
-     */
-    void AddCommonEnemy(int x, int y, int activationPoint, bool faceLeft);
-
-    /**
-     * @brief Adds a soldier enemy with the given parameters.
+     * @brief Adds an enemy of the given type with the given parameters (its size and sprite come from its archetype).
+     * @param type Type of the enemy.
      * @param x x coordinate of spawn point.
      * @param y y coordinate of spawn point.
      * @param activationPoint When the player reaches this x coordinate, the enemy gets activated.
      * @param faceLeft Contains whether enemy faces left.
-     * @see SoldierEnemy
+     * @see EnemyArchetype
      */
-    void AddSoldierEnemy(int x, int y, int activationPoint, bool faceLeft);
+    void AddEnemy(EnemyType::Type type, int x, int y, int activationPoint, bool faceLeft);
 
     /**
-     * @brief Adds a king enemy with the given parameters.
+     * @brief Spawns an activated temporary enemy (above a MysteryBlock). A removed enemy of the same type is reused if there is one.
+     * @param type Type of the enemy.
      * @param x x coordinate of spawn point.
      * @param y y coordinate of spawn point.
-     * @param activationPoint When the player reaches this x coordinate, the enemy gets activated.
-     * @param faceLeft Contains whether enemy faces left.
-     * @see KingEnemy
-     */
-    void AddKingEnemy(int x, int y, int activationPoint, bool faceLeft);
-
-    /**
-     * @brief Adds a red mushroom enemy with the given parameters.
-     * @param x x coordinate of spawn point.
-     * @param y y coordinate of spawn point.
-     * @param activationPoint When the player reaches this x coordinate, the enemy gets activated.
-     * @param faceLeft Contains whether enemy faces left.
-     * @see RedMushroomEnemy
-     */
-    void AddRedMushroomEnemy(int x, int y, int activationPoint, bool faceLeft);
-
-    /**
-     * @brief Adds a purple mushroom enemy with the given parameters.
-     * @param x x coordinate of spawn point.
-     * @param y y coordinate of spawn point.
-     * @param activationPoint When the player reaches this x coordinate, the enemy gets activated.
-     * @param faceLeft Contains whether enemy faces left.
-     * @see PurpleMushroomEnemy
      */
-    void AddPurpleMushroomEnemy(int x, int y, int activationPoint, bool faceLeft);
+    void SpawnEnemy(EnemyType::Type type, int x, int y);
 
     /****************************************************************************************/
 
@@ -293,12 +422,59 @@ private:
 
     /****************************************************************************************/
 
+    /**
+     * @brief Adds a block of the given type with the given grid index (or removes the block if the type is NONE).
+     * @param type Type of the block.
+     * @param row Row index of the grid.
+     * @param column Column index of the grid.
+     */
+    void AddBlock(BlockType::Type type, int row, int column);
+
+    /**
+     * @brief Adds an enemy of the given type.
+     * @param object Type, spawn point and activation of the enemy.
+     */
+    void AddEnemy(const ObjectData& object);
+
+    /**
+     * @brief Adds a level element of the given type.
+     * @param object Type and spawn point (and activation) of the element.
+     */
+    void AddElement(const ObjectData& object);
+
+    /****************************************************************************************/
+
     /**
      * @brief Creates the game objects from the config file.
      * @param configFile Text file that the level is configured from.
      */
     void LoadLevelFromConfigFile(std::string configFile);
 
+    /**
+     * @brief Reads the config file without creating any game objects.
+     * @param configFile Text file that the level is configured from.
+     * @param definition The config is read into this.
+     * @return Returns false if the file could not be opened. Throws std::runtime_error if the config is invalid (e.g. its Grid or Player section is missing).
+     */
+    bool ReadConfigFile(const std::string& configFile, LevelDefinition& definition);
+
+    /**
+     * @brief Auxiliary function: reads a block section into the grid cells of the definition.
+     * @param in Reference to input stream.
+     * @param definition The grid cells of this definition are set.
+     * @param type Type of the blocks in the section.
+     */
+    void ReadBlocks(std::istream& in, LevelDefinition& definition, BlockType::Type type);
+
+    /**
+     * @brief Auxiliary function: reads a section of objects that are given by coordinates or by enemy data.
+     * @param in Reference to input stream.
+     * @param objects The objects are appended to this.
+     * @param type Name of the section.
+     * @param hasEnemyData Contains whether the lines contain activation point and facing.
+     */
+    void ReadObjects(std::istream& in, std::vector<ObjectData>& objects, const std::string& type, bool hasEnemyData);
+
     /**
      * @brief Auxiliary function: converts string to bool.
      * @param token Valid arguments: "true" or "false".
@@ -308,40 +484,93 @@ private:
 
     /**
      * @brief Auxiliary function: reads an integer from input stream.
-     * @param in Reference to input file stream.
+     * @param in Reference to input stream.
      * @return Returns the integer read from the input file stream.
      */
-    int ReadInt(std::ifstream& in);
+    int ReadInt(std::istream& in);
 
     /**
      * @brief Auxiliary function: reads a coordinate consisting of two integers from input stream.
-     * @param in Reference to input file stream.
+     * @param in Reference to input stream.
      * @return Returns the coordinate read from the input file stream.
      */
-    Coordinate ReadCoordinate(std::ifstream& in);
+    Coordinate ReadCoordinate(std::istream& in);
 
     /**
      * @brief Auxiliary function: reads an integer from input stream.
-     * @param in Reference to input file stream.
+     * @param in Reference to input stream.
      * @return Returns the integer read from the input file stream.
      */
-    EnemyData ReadEnemyData(std::ifstream& in);
+    EnemyData ReadEnemyData(std::istream& in);
 
 public:
     /**
      * @brief Creates a level from the config file.
      * @param configFile Path to the config file.
-     * @param window Pointer to the window. Necessary for configuration.
-     * @param frameDelay Duration between two update cycles.
+     * @param window Pointer to the window. Necessary for configuration (nullptr for headless simulation).
      */
-    Level(std::string configFile, RenderWindow* window, int frameDelay);
+    Level(std::string configFile, RenderWindow* window);
 
     /**
-     * @brief Updates all the game objects.
+     * @brief Updates all the game objects, and advances the simulated time of the world.
      * @param dt Delta time.
      */
     void Update(float dt);
 
+    /**
+     * @brief Applies the keys to the player: jumping and running. Does nothing if the player is dead or forced by the flag.
+     * @param input Keys that move the player.
+     * @param dt Delta time.
+     */
+    void HandleInput(const PlayerInput& input, float dt);
+
+    /**
+     * @brief Simulates a single update cycle: updates the game objects, then checks for death, collision and animations.
+     * @param input Keys that move the player.
+     * @param dt Delta time.
+     */
+    void Simulate(const PlayerInput& input, float dt);
+
+    /**
+     * @brief A whole update cycle without rendering: clears the events, handles the input and simulates the level.
+     * @param input Keys that move the player.
+     * @param dt Delta time.
+     */
+    void Step(const PlayerInput& input, float dt);
+
+    /**
+     * @brief Emits the trails of the active lasers, and updates the particles (not part of Simulate, so a headless simulation skips it).
+     * @param dt Delta time.
+     */
+    void UpdateParticles(float dt);
+
+    /**
+     * @brief Sets the coyote time (0 by default, so a headless simulation is not affected).
+     * @param milliSeconds The player can still jump for this many milliseconds after leaving the ground.
+     */
+    void SetCoyoteTime(float milliSeconds);
+
+    /**
+     * @brief Seeds the random generator of the level, so the same inputs always produce the same simulation.
+     * @param seed Seed of the random generator.
+     */
+    void SetSeed(unsigned int seed);
+
+    /**
+     * @return Returns a deep copy of the level with its current state (necessary for searching for inputs from the same state).
+     */
+    std::unique_ptr<Level> Clone() const;
+
+    /**
+     * @return Returns the events of the last update cycle.
+     */
+    std::vector<LevelEvent>& GetEvents();
+
+    /**
+     * @return Returns the player.
+     */
+    Player& GetPlayer();
+
     /**
      * @brief Renders all the game objects.
      */
@@ -353,7 +582,25 @@ public:
     void Reset();
 
     /**
-     * @brief Destructor. Destroys class Entity's static texture member.
+     * @brief Reads the config file again and patches only the changed grid cells, enemies and level elements.
+     * The player and the camera are kept where they are, and unchanged objects keep their state.
+     * @return Returns whether the level has been patched (false if the file is invalid, e.g. half-saved).
+     */
+    bool Reload();
+
+    /**
+     * @return Returns the path to the config file.
+     */
+    const std::string& GetConfigFile() const;
+
+    /**
+     * @return Returns the simulation state of the level.
+     * @see World
+     */
+    World& GetWorld();
+
+    /**
+     * @brief Destructor. Destroys the static texture members of Entity, Block and LevelElement if no other level uses them.
      */
     ~Level();
 };
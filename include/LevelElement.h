@@ -13,6 +13,7 @@
 #include <SDL2/SDL_image.h>
 
 #include <iostream>
+#include <memory>
 
 #include "GameObject.h"
 #include "Texture.h"
@@ -26,14 +27,10 @@ class Entity;
  */
 class LevelElement : public GameObject {
     friend class GameEngine;
+    friend class Level;
 public:
     static SDL_Texture* textures;   ///< Static member: stores all the block textures.
 
-protected:
-    bool isActivated;   ///< Contains whether the element is activated.
-    bool playSound;     ///< This is how it shows that it wants to play a sound.
-
-public:
     /**
      * @brief Creates a new LevelElement with the given boxes.
      * @param hitBox Hitbox of the object.
@@ -58,6 +55,16 @@ public:
      */
     virtual void Reset();
 
+    /**
+     * @return Returns the player's position where the element is activated. By default it is activated in the first update cycle.
+     */
+    virtual int GetActivationPoint() const;
+
+    /**
+     * @brief Activates the element (called by the Level when the player reaches the activation point).
+     */
+    virtual void Activate();
+
     /**
      * @brief Handles being touched by an Entity.
      * @param entity The entity which it is touched by.
@@ -66,7 +73,12 @@ public:
     virtual void TouchedBy(Entity* entity);
 
     /**
-     * @brief Destructor: destroys static texture.
+     * @return Returns a copy of the element with its current state (necessary for cloning the level).
+     */
+    virtual std::unique_ptr<LevelElement> Clone() const;
+
+    /**
+     * @brief Destructor. The static texture is destroyed by the level (single elements can be removed when reloading).
      */
     virtual ~LevelElement();
 };
@@ -101,6 +113,11 @@ public:
      */
     void TouchedBy(Entity* entity) override;
 
+    /**
+     * @return Returns a copy of the element with its current state (necessary for cloning the level).
+     */
+    std::unique_ptr<LevelElement> Clone() const override;
+
     /**
      * @brief Destructor.
      */
@@ -139,6 +156,16 @@ public:
      */
     void Reset() override;
 
+    /**
+     * @return Returns the player's position where the Fish is activated (it has to pass the activation point).
+     */
+    int GetActivationPoint() const override;
+
+    /**
+     * @brief Activates the Fish, and makes it play its sound.
+     */
+    void Activate() override;
+
     /**
      * @brief Handles being touched by an Entity.
      * @param entity The entity which it is touched by.
@@ -146,6 +173,11 @@ public:
      */
     void TouchedBy(Entity* entity) override;
 
+    /**
+     * @return Returns a copy of the element with its current state (necessary for cloning the level).
+     */
+    std::unique_ptr<LevelElement> Clone() const override;
+
     /**
      * @brief Destructor.
      */
@@ -184,6 +216,21 @@ public:
      */
     void Reset() override;
 
+    /**
+     * @return Returns the player's position where the Laser is activated (it has to pass the activation point).
+     */
+    int GetActivationPoint() const override;
+
+    /**
+     * @return Returns whether the Laser faces left (the trail is emitted behind it).
+     */
+    bool IsFacingLeft() const;
+
+    /**
+     * @brief Activates the Laser, and makes it play its sound.
+     */
+    void Activate() override;
+
     /**
      * @brief Handles being touched by an Entity.
      * @param entity The entity which it is touched by.
@@ -191,6 +238,11 @@ public:
      */
     void TouchedBy(Entity* entity) override;
 
+    /**
+     * @return Returns a copy of the element with its current state (necessary for cloning the level).
+     */
+    std::unique_ptr<LevelElement> Clone() const override;
+
     /**
      * @brief Destructor.
      */
@@ -220,6 +272,11 @@ public:
      */
     void TouchedBy(Entity* entity) override;
 
+    /**
+     * @return Returns a copy of the element with its current state (necessary for cloning the level).
+     */
+    std::unique_ptr<LevelElement> Clone() const override;
+
     /**
      * @brief Destructor.
      */
@@ -250,6 +307,11 @@ public:
      */
     void TouchedBy(Entity* entity);
 
+    /**
+     * @return Returns a copy of the element with its current state (necessary for cloning the level).
+     */
+    std::unique_ptr<LevelElement> Clone() const override;
+
     /**
      * @brief Destructor.
      */
@@ -278,6 +340,11 @@ public:
      */
     void TouchedBy(Entity* entity) override;
 
+    /**
+     * @return Returns a copy of the element with its current state (necessary for cloning the level).
+     */
+    std::unique_ptr<LevelElement> Clone() const override;
+
     /**
      * @brief Destructor.
      */
@@ -308,6 +375,11 @@ public:
      */
     void TouchedBy(Entity* entity) override;
 
+    /**
+     * @return Returns a copy of the element with its current state (necessary for cloning the level).
+     */
+    std::unique_ptr<LevelElement> Clone() const override;
+
     /**
      * @brief Destructor.
      */
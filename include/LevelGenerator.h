@@ -0,0 +1,116 @@
+/** @file LevelGenerator.h
+  * @brief Procedurally generates level config files for stress testing.
+  *
+  * The generated files use the same format as the hand-made levels
+  * (Grid, Player, UpperDirtBlock, CommonEnemy, ...), so they can be
+  * loaded by class Level without any modification. The generator is
+  * seeded, thus the same parameters always produce the same level.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef LEVEL_GENERATOR_H
+#define LEVEL_GENERATOR_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+
+/**
+ * @brief Parameters of a generated level.
+ */
+struct GeneratorConfig {
+    int width = 200;            ///< Width of the grid counted in blocks.
+    float blockDensity = 0.1f;  ///< Probability of a floating block in every cell of the floating rows (0.0 - 1.0).
+    int commonEnemies = 0;      ///< Number of common enemies.
+    int soldierEnemies = 0;     ///< Number of soldier enemies.
+    int kingEnemies = 0;        ///< Number of king enemies.
+    int redMushroomEnemies = 0;     ///< Number of red mushroom enemies.
+    int purpleMushroomEnemies = 0;  ///< Number of purple mushroom enemies.
+    int fish = 0;       ///< Number of fish.
+    int lasers = 0;     ///< Number of lasers.
+    int tubes = 0;      ///< Number of tubes (high, middle and low tubes are mixed).
+    int clouds = 0;     ///< Number of clouds.
+    unsigned int seed = 0;  ///< Seed of the random generator.
+};
+
+/**
+ * @brief Generates a level config file from the given parameters.
+ */
+class LevelGenerator {
+public:
+    static const int height;    ///< Static member: height of the grid counted in blocks (same as the hand-made levels).
+    static const int blockSize; ///< Static member: size of the scaled blocks counted in pixels.
+    static const int groundY;   ///< Static member: y coordinate of the top of the ground.
+
+private:
+    GeneratorConfig config; ///< Parameters of the level.
+    std::mt19937 random;    ///< Seeded random generator, necessary for reproducibility.
+
+    /**
+     * @param min Lower limit (inclusive).
+     * @param max Upper limit (inclusive).
+     * @return Returns a random integer between min and max.
+     */
+    int RandomInt(int min, int max);
+
+    /**
+     * @return Returns the x coordinate of the end flag.
+     */
+    int EndFlagX() const;
+
+    /**
+     * @brief Writes the grid size, the player and the ground blocks.
+     * @param out Output stream.
+     */
+    void WriteGround(std::ostream& out);
+
+    /**
+     * @brief Writes the floating blocks according to the block density.
+     * @param out Output stream.
+     */
+    void WriteBlocks(std::ostream& out);
+
+    /**
+     * @brief Writes a single enemy section with randomly placed enemies.
+     * @param out Output stream.
+     * @param name Name of the section (e.g. "CommonEnemy").
+     * @param count Number of enemies.
+     * @param hitBoxHeight Height of the enemy's hit box (necessary for placing it on the ground).
+     */
+    void WriteEnemies(std::ostream& out, const std::string& name, int count, int hitBoxHeight);
+
+    /**
+     * @brief Writes the fish, the lasers, the tubes, the clouds, the end flag and the house.
+     * @param out Output stream.
+     */
+    void WriteElements(std::ostream& out);
+
+public:
+    /**
+     * @brief Creates a new generator with the given parameters.
+     * @param config Parameters of the level.
+     */
+    LevelGenerator(const GeneratorConfig& config);
+
+    /**
+     * @brief Generates the level and writes it to the output stream. Reseeds the generator, so calling it again produces the same level.
+     * @param out Output stream.
+     */
+    void Generate(std::ostream& out);
+
+    /**
+     * @brief Generates the level and writes it to the given file.
+     * @param path Path to the config file.
+     */
+    void Generate(const std::string& path);
+
+    /**
+     * @brief Destructor.
+     */
+    ~LevelGenerator();
+};
+
+#endif // LEVEL_GENERATOR_H
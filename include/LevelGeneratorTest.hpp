@@ -0,0 +1,86 @@
+/** @file LevelGeneratorTest.hpp
+  * @brief This file contains tests for the module LevelGenerator
+  *
+  * For testing, it uses the gtest_lite.h library.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+# include <iostream>
+# include <sstream>
+# include <string>
+
+#include "gtest_lite.h"
+#include "LevelGenerator.h"
+
+void TEST_LevelGenerator() {
+    GeneratorConfig config;
+    config.width = 100;
+    config.commonEnemies = 10;
+    config.soldierEnemies = 5;
+    config.fish = 4;
+    config.tubes = 3;
+    config.seed = 42;
+
+    /***** Checking the Constructor *****/
+
+    // Checks for throwing error for invalid parameters
+    TEST(LevelGenerator, InvalidConfig) {
+        GeneratorConfig narrow = config;
+        narrow.width = 10;
+        EXPECT_ANY_THROW(LevelGenerator{narrow});
+
+        GeneratorConfig dense = config;
+        dense.blockDensity = 1.5f;
+        EXPECT_ANY_THROW(LevelGenerator{dense});
+
+        EXPECT_NO_THROW(LevelGenerator{config});
+    } END
+
+    /***** Checking Generate *****/
+
+    // Checks whether the same seed produces the same level (even when generating twice)
+    TEST(LevelGenerator, Reproducible) {
+        std::ostringstream first, second, third;
+        LevelGenerator generator(config);
+        generator.Generate(first);
+        generator.Generate(second);
+        LevelGenerator(config).Generate(third);
+        EXPECT_STREQ(first.str().c_str(), second.str().c_str());
+        EXPECT_STREQ(first.str().c_str(), third.str().c_str());
+
+        GeneratorConfig other = config;
+        other.seed = 43;
+        std::ostringstream different;
+        LevelGenerator(other).Generate(different);
+        EXPECT_FALSE(first.str() == different.str());
+    } END
+
+    // Checks the grid header and the section counts
+    TEST(LevelGenerator, Sections) {
+        std::ostringstream out;
+        LevelGenerator(config).Generate(out);
+        std::istringstream in(out.str());
+        std::string line;
+
+        std::getline(in, line);
+        EXPECT_STREQ("Grid", line.c_str());
+        std::getline(in, line);
+        EXPECT_STREQ("(100,12)", line.c_str());
+
+        int common = -1, soldier = -1, fish = -1, endFlag = -1, king = -1;
+        while (std::getline(in, line)) {
+            if (line == "CommonEnemy") in >> common;
+            else if (line == "SoldierEnemy") in >> soldier;
+            else if (line == "KingEnemy") in >> king;
+            else if (line == "Fish") in >> fish;
+            else if (line == "EndFlag") in >> endFlag;
+        }
+        EXPECT_EQ(10, common);
+        EXPECT_EQ(5, soldier);
+        EXPECT_EQ(4, fish);
+        EXPECT_EQ(1, endFlag);
+        EXPECT_EQ(-1, king);    // Empty sections are not written
+    } END
+}
@@ -0,0 +1,139 @@
+/** @file LevelRegistry.h
+  * @brief Contains class LevelRegistry, the index of the levels listed in the level manifest.
+  *
+  * The manifest (res/levels/Levels.txt) lists the levels in the order they are
+  * played, one per line: the path of the level file relative to res/, optionally
+  * followed by the name of the level. Empty lines and lines beginning with '#'
+  * are skipped. Scanning the manifest reads every level once for its size and
+  * checksum, then the index is cached (see PixelCache), so the startup does not
+  * read the levels again until the manifest changes. A level that is edited
+  * without touching the manifest is noticed when it is loaded (see Matches),
+  * then the index is rebuilt.
+  *
+  * Layout of the index (native byte order):
+  * - Header: magic "CMLV", version, number of levels.
+  * - Records: size, checksum and the offsets of the name and the path of every level.
+  * - Strings: the names and paths one after another, each terminated by '\0'.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef LEVEL_REGISTRY_H
+#define LEVEL_REGISTRY_H
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <memory>
+#include <functional>
+#include <cstdint>
+
+#include "PixelCache.h"
+
+/**
+ * @brief Index of the levels in the order of the manifest.
+ */
+class LevelRegistry {
+public:
+    typedef std::function<std::string_view(const std::string& path, std::string& buffer)> Reader;  ///< Reads a level file (see Assets::Read).
+
+    static const std::uint32_t version;     ///< Static member: version of the index format.
+    static const size_t none;   ///< Static member: index that does not belong to any level.
+
+    /**
+     * @brief Header at the beginning of the index.
+     */
+    struct Header {
+        char magic[4];          ///< Always "CMLV".
+        std::uint32_t version;  ///< Version of the index format.
+        std::uint32_t count;    ///< Number of levels.
+        std::uint32_t reserved; ///< Unused (keeps the records aligned).
+    };
+
+    /**
+     * @brief A single level in the index.
+     */
+    struct Record {
+        std::uint64_t size;     ///< Size of the level file in bytes.
+        std::uint64_t checksum; ///< Hash of the level file (see PixelCache::Hash).
+        std::uint32_t name;     ///< Offset of the name (relative to the first string).
+        std::uint32_t path;     ///< Offset of the path (relative to the first string).
+    };
+
+    /**
+     * @brief A level as it is returned by the registry.
+     */
+    struct Entry {
+        std::string_view name;  ///< Name of the level (empty if the manifest does not give one).
+        std::string_view path;  ///< Path to the level file relative to res/.
+        std::uint64_t size;     ///< Size of the level file in bytes.
+        std::uint64_t checksum; ///< Hash of the level file.
+    };
+
+private:
+    std::string compiled;   ///< The index if it is built in memory (empty if it is mapped).
+    std::unique_ptr<PixelCache> mapping;    ///< The mapped cache file if the index is read from the cache.
+    const Header* header;   ///< Header of the index.
+    const Record* records;  ///< Records of the levels.
+    const char* strings;    ///< Beginning of the strings.
+
+    /**
+     * @brief Creates a registry without an index (see Load).
+     */
+    LevelRegistry();
+
+    /**
+     * @brief Checks the index, and sets the pointers into it.
+     * @param table The index.
+     * @return Returns false if the index is corrupted.
+     */
+    bool Attach(std::string_view table);
+
+public:
+    LevelRegistry(const LevelRegistry&) = delete;
+    LevelRegistry& operator=(const LevelRegistry&) = delete;
+
+    /**
+     * @brief Maps the index from the cache, or scans the manifest and writes the cache first.
+     * @param manifest Contents of the manifest.
+     * @param cachePath Path to the cache file of the index (empty: the manifest is always scanned, e.g. while the levels are edited).
+     * @param read Reads the level files (only called when the manifest is scanned).
+     * @param isRebuilt Contains whether the manifest is scanned even if the cache is valid (e.g. a level has changed since the cache was written).
+     * @return Returns the loaded registry.
+     */
+    static std::unique_ptr<LevelRegistry> Load(std::string_view manifest, const std::string& cachePath, const Reader& read, bool isRebuilt = false);
+
+    /**
+     * @brief Scans the manifest, and builds the index. Missing level files are reported and skipped.
+     * @param manifest Input stream of the manifest.
+     * @param read Reads the level files.
+     * @return Returns the index.
+     */
+    static std::string Compile(std::istream& manifest, const Reader& read);
+
+    /**
+     * @return Returns the number of levels.
+     */
+    size_t GetCount() const;
+
+    /**
+     * @param index Index of the level (in the order of the manifest).
+     * @return Returns the level at the given index.
+     */
+    Entry GetEntry(size_t index) const;
+
+    /**
+     * @param index Index of the level (in the order of the manifest).
+     * @param level Contents of the level file.
+     * @return Returns whether the size and the checksum of the level match its entry (false: the index is stale).
+     */
+    bool Matches(size_t index, std::string_view level) const;
+
+    /**
+     * @brief Destructor.
+     */
+    ~LevelRegistry();
+};
+
+#endif // LEVEL_REGISTRY_H
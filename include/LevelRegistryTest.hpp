@@ -0,0 +1,118 @@
+/** @file LevelRegistryTest.hpp
+  * @brief This file contains tests for the module LevelRegistry
+  *
+  * For testing, it uses the gtest_lite.h library.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+# include <iostream>
+# include <fstream>
+# include <sstream>
+# include <string>
+# include <string_view>
+# include <map>
+# include <filesystem>
+
+#include "gtest_lite.h"
+#include "LevelRegistry.h"
+#include "PixelCache.h"
+
+void TEST_LevelRegistry() {
+    // Level files in memory, the reader counts how many times they are read
+    std::map<std::string, std::string> files = {
+        { "levels/Level1.txt", "Grid\n(200,12)\n" },
+        { "levels/Level2.txt", "Grid\n(300,12)\nPlayer\n(60,665)\n" },
+        { "levels/Bonus.txt", "Grid\n(50,12)\n" }
+    };
+    int reads = 0;
+    LevelRegistry::Reader read = [&files, &reads](const std::string& path, std::string& buffer) {
+        ++reads;
+        auto it = files.find(path);
+        if (it == files.end())
+            return std::string_view();
+        buffer = it->second;
+        return std::string_view(buffer);
+    };
+
+    /***** Checking the Manifest *****/
+
+    // Checks whether the levels are indexed in the order of the manifest, and the missing ones are skipped
+    TEST(LevelRegistry, Manifest) {
+        std::string manifest =
+            "# Main levels\n"
+            "levels/Level1.txt\n"
+            "\n"
+            "levels/Missing.txt\n"
+            "  levels/Bonus.txt   Secret Garden  \n"
+            "levels/Level2.txt\n";
+
+        std::unique_ptr<LevelRegistry> registry = LevelRegistry::Load(manifest, "", read);
+        EXPECT_EQ((size_t) 3, registry->GetCount());
+        EXPECT_EQ(std::string("levels/Level1.txt"), std::string(registry->GetEntry(0).path));
+        EXPECT_TRUE(registry->GetEntry(0).name.empty());
+        EXPECT_EQ(std::string("levels/Bonus.txt"), std::string(registry->GetEntry(1).path));
+        EXPECT_EQ(std::string("Secret Garden"), std::string(registry->GetEntry(1).name));
+        EXPECT_EQ(std::string("levels/Level2.txt"), std::string(registry->GetEntry(2).path));
+
+        EXPECT_EQ((std::uint64_t) files["levels/Level2.txt"].size(), registry->GetEntry(2).size);
+        EXPECT_EQ(PixelCache::Hash(files["levels/Level2.txt"]), registry->GetEntry(2).checksum);
+        EXPECT_NE(registry->GetEntry(0).checksum, registry->GetEntry(1).checksum);
+        EXPECT_THROW(registry->GetEntry(3), const std::out_of_range&);
+
+        std::unique_ptr<LevelRegistry> empty = LevelRegistry::Load("# Nothing yet\n", "", read);
+        EXPECT_EQ((size_t) 0, empty->GetCount());
+    } END
+
+    /***** Checking the Cache *****/
+
+    // Checks whether the index is read back from the cache without reading the levels again
+    TEST(LevelRegistry, Cache) {
+        const std::string cachePath = (std::filesystem::temp_directory_path() / "Cat-Mario-Test.idx").string();
+        std::filesystem::remove(cachePath);
+        std::string manifest = "levels/Level1.txt\nlevels/Level2.txt Finale\n";
+
+        reads = 0;
+        std::unique_ptr<LevelRegistry> scanned = LevelRegistry::Load(manifest, cachePath, read);
+        EXPECT_EQ(2, reads);
+        EXPECT_TRUE(std::filesystem::exists(cachePath));
+
+        std::unique_ptr<LevelRegistry> mapped = LevelRegistry::Load(manifest, cachePath, read);
+        EXPECT_EQ(2, reads);
+        EXPECT_EQ((size_t) 2, mapped->GetCount());
+        EXPECT_EQ(std::string("Finale"), std::string(mapped->GetEntry(1).name));
+        EXPECT_EQ(scanned->GetEntry(1).checksum, mapped->GetEntry(1).checksum);
+
+        // A changed manifest is scanned again
+        std::unique_ptr<LevelRegistry> changed = LevelRegistry::Load(manifest + "levels/Bonus.txt\n", cachePath, read);
+        EXPECT_EQ(5, reads);
+        EXPECT_EQ((size_t) 3, changed->GetCount());
+        std::filesystem::remove(cachePath);
+    } END
+
+    // Checks whether a level changed without touching the manifest is noticed, and the index is rebuilt
+    TEST(LevelRegistry, Changed Level) {
+        const std::string cachePath = (std::filesystem::temp_directory_path() / "Cat-Mario-Test.idx").string();
+        std::filesystem::remove(cachePath);
+        std::string manifest = "levels/Level1.txt\nlevels/Level2.txt\n";
+        LevelRegistry::Load(manifest, cachePath, read);
+        EXPECT_TRUE(LevelRegistry::Load(manifest, cachePath, read)->Matches(0, files["levels/Level1.txt"]));
+
+        files["levels/Level1.txt"] = "Grid\n(250,12)\nPlayer\n(60,665)\n";
+        std::unique_ptr<LevelRegistry> stale = LevelRegistry::Load(manifest, cachePath, read);
+        EXPECT_FALSE(stale->Matches(0, files["levels/Level1.txt"]));
+        EXPECT_TRUE(stale->Matches(1, files["levels/Level2.txt"]));
+
+        reads = 0;
+        std::unique_ptr<LevelRegistry> rebuilt = LevelRegistry::Load(manifest, cachePath, read, true);
+        EXPECT_EQ(2, reads);
+        EXPECT_TRUE(rebuilt->Matches(0, files["levels/Level1.txt"]));
+
+        // The rebuilt index is cached
+        std::unique_ptr<LevelRegistry> mapped = LevelRegistry::Load(manifest, cachePath, read);
+        EXPECT_EQ(2, reads);
+        EXPECT_TRUE(mapped->Matches(0, files["levels/Level1.txt"]));
+        std::filesystem::remove(cachePath);
+    } END
+}
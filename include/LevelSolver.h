@@ -0,0 +1,125 @@
+/** @file LevelSolver.h
+  * @brief Searches for an input sequence that completes a level (automated playtesting).
+  *
+  * The solver simulates the level headlessly (without window, renderer
+  * and audio) using a beam search: every state of the beam is cloned
+  * and stepped with each action for a fixed number of update cycles,
+  * the dead ends are dropped, similar states are merged, and only the
+  * furthest states are kept. The expansion of the beam is spread over
+  * several threads, every thread simulates its own level clones.
+  *
+  * If the level cannot be completed, the furthest x coordinate that the
+  * player reached is reported, so the unreachable section can be found.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef LEVEL_SOLVER_H
+#define LEVEL_SOLVER_H
+
+#ifndef CPORTA
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <memory>
+
+#include "Level.h"
+
+/**
+ * @brief Parameters of the search.
+ */
+struct SolverConfig {
+    int beamWidth = 64;     ///< Number of states that are kept after every step of the search.
+    int ticksPerAction = 10;    ///< Number of update cycles an action is held for.
+    int maxActions = 2000;  ///< Limit of the length of the input sequence counted in actions.
+    int stallLimit = 100;   ///< The search gives up if the furthest position does not improve for this many actions.
+    int threads = 0;        ///< Number of worker threads (0: number of hardware threads).
+    int frameDelay = 10;    ///< Duration between two update cycles (the game's default, see PerformanceConfig).
+    unsigned int seed = 0;  ///< Seed of the level's random generator (spawns of MysteryBlock(s)).
+};
+
+/**
+ * @brief Outcome of the search.
+ */
+struct SolverResult {
+    bool isCompleted = false;   ///< Contains whether the level has been completed.
+    int furthestX = 0;          ///< The furthest x coordinate that the player reached.
+    long long simulatedTicks = 0;   ///< Number of update cycles simulated during the search.
+    std::vector<PlayerInput> actions;   ///< Input sequence that reaches the furthest position (each is held for SolverConfig::ticksPerAction cycles).
+};
+
+/**
+ * @brief Searches for an input sequence that completes a level.
+ */
+class LevelSolver {
+public:
+    static const PlayerInput actions[];  ///< Static member: the actions that are tried from every state (idle, run, jump and their combinations).
+    static const int actionCount;        ///< Static member: number of actions.
+
+private:
+    /**
+     * @brief A single state of the search.
+     */
+    struct Node {
+        std::unique_ptr<Level> level;   ///< State of the simulation.
+        std::vector<unsigned char> path;    ///< Indices of the actions that lead to this state.
+        int progress;   ///< The player's x coordinate (score of the state).
+        bool isDead;    ///< Contains whether the player died.
+    };
+
+    SolverConfig config;    ///< Parameters of the search.
+
+    /**
+     * @brief Steps the node's level with the action for SolverConfig::ticksPerAction cycles.
+     * @param node Reference to the node (cloned from its parent).
+     * @param action Index of the action.
+     */
+    void Expand(Node& node, int action) const;
+
+    /**
+     * @brief Expands every node of the beam with every action, using the worker threads.
+     * @param beam The current states.
+     * @return Returns the new states (in the same order for any number of threads).
+     */
+    std::vector<Node> ExpandBeam(const std::vector<Node>& beam) const;
+
+    /**
+     * @param node Reference to the node.
+     * @return Returns a key of the player's rounded position and velocity (states with the same key are merged).
+     * The fields are packed into disjoint bits: x and y (divided by 4) take 24 bits each, the doubled velocities 8 bits each.
+     */
+    static std::uint64_t StateKey(Node& node);
+
+public:
+    /**
+     * @brief Creates a solver with the given parameters.
+     * @param config Parameters of the search.
+     */
+    LevelSolver(const SolverConfig& config);
+
+    /**
+     * @brief Runs the search on the given level.
+     * @param configFile Path to the config file of the level relative to res/ (see Assets).
+     * @return Returns the outcome of the search.
+     */
+    SolverResult Solve(const std::string& configFile) const;
+
+    /**
+     * @brief Writes the input sequence: one line per action, the number of cycles it is held for followed by the pressed keys (L, R, U or -).
+     * @param out Output stream.
+     * @param result The outcome of the search.
+     */
+    void WriteInputs(std::ostream& out, const SolverResult& result) const;
+
+    /**
+     * @brief Destructor.
+     */
+    ~LevelSolver();
+};
+
+#endif // CPORTA
+
+#endif // LEVEL_SOLVER_H
@@ -0,0 +1,56 @@
+/** @file LevelWatcher.h
+  * @brief Watches the config file of the loaded level, so that it can be reloaded while the game is running.
+  *
+  * Uses inotify on Linux. The directory of the file is watched instead of the
+  * file itself, because most editors save by writing a new file and renaming
+  * it over the old one. On other platforms the watcher never reports changes.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef LEVEL_WATCHER_H
+#define LEVEL_WATCHER_H
+
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Reports whenever the watched config file has been saved.
+ */
+class LevelWatcher {
+private:
+    int fileDescriptor;     ///< inotify instance (-1 if it is unavailable).
+    int watchDescriptor;    ///< Watch of the directory (-1 if nothing is watched).
+    std::string fileName;   ///< Name of the watched file without its directory.
+
+public:
+    /**
+     * @brief Creates a new (non-blocking) inotify instance without watching anything.
+     */
+    LevelWatcher();
+
+    /**
+     * @brief Starts watching the given file (and stops watching the previous one).
+     * @param path Path to the config file.
+     */
+    void Watch(const std::string& path);
+
+    /**
+     * @brief Stops watching the file.
+     */
+    void Stop();
+
+    /**
+     * @brief Reads all the pending events without blocking.
+     * @return Returns whether the watched file has been saved since the last call.
+     */
+    bool HasChanged();
+
+    /**
+     * @brief Destructor: closes the inotify instance.
+     */
+    ~LevelWatcher();
+};
+
+#endif // LEVEL_WATCHER_H
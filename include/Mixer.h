@@ -0,0 +1,117 @@
+/** @file Mixer.h
+  * @brief Contains class Mixer, a software mixer of sound effects with a fixed pool of voices.
+  *
+  * The game thread hands the sounds over through a lock-free command queue,
+  * so it never waits for the audio thread. The audio thread takes the commands
+  * at the beginning of every buffer and mixes the playing voices into it.
+  *
+  * If every voice is busy, the voice with the lowest priority (the oldest of
+  * them) is stolen, but only for a sound with at least the same priority.
+  * The same sound is not started again within a short interval, and only a
+  * few instances of it can play at the same time (the oldest is restarted).
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef MIXER_H
+#define MIXER_H
+
+#include <iostream>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * @brief Mixes 16-bit samples of sound effects on a fixed number of voices.
+ */
+class Mixer {
+public:
+    /**
+     * @brief A request of the game thread.
+     */
+    struct Command {
+        enum Type { PLAY=0, STOP };     ///< Type of the command.
+        Type type;      ///< PLAY starts a sound, STOP stops every voice.
+        const std::int16_t* samples;    ///< Samples of the sound (interleaved, in the format of the audio device).
+        std::uint32_t length;   ///< Number of samples.
+        int sound;      ///< Identifier of the sound (e.g. Sound::Type).
+        int priority;   ///< The sound can only steal voices with lower or equal priority.
+        bool loop;      ///< Contains whether the sound is looped.
+    };
+
+private:
+    /**
+     * @brief A voice that plays a single sound.
+     */
+    struct Voice {
+        const std::int16_t* samples = nullptr;  ///< Samples of the sound (nullptr if the voice is free).
+        std::uint32_t length = 0;       ///< Number of samples.
+        std::uint32_t position = 0;     ///< Index of the next sample.
+        int sound = 0;          ///< Identifier of the sound.
+        int priority = 0;       ///< Priority of the sound.
+        bool loop = false;      ///< Contains whether the sound is looped.
+        std::uint64_t started = 0;  ///< Value of the sample clock when the sound was started.
+    };
+
+    std::vector<Voice> voices;      ///< The voice pool (its size never changes).
+    std::vector<Command> commands;  ///< Ring buffer of the commands.
+    std::atomic<size_t> head;       ///< Index of the next command to be taken (written only by the audio thread).
+    std::atomic<size_t> tail;       ///< Index of the next free slot (written only by the game thread).
+    std::uint64_t clock;            ///< Number of samples mixed so far.
+    std::uint64_t repeatInterval;   ///< The same sound is not started again within this many samples.
+    int maxInstances;               ///< Maximum number of voices playing the same sound.
+
+    /**
+     * @brief Starts a sound on a free or stolen voice.
+     * @param command The PLAY command.
+     */
+    void Start(const Command& command);
+
+public:
+    /**
+     * @brief Creates a mixer.
+     * @param voiceCount Number of voices.
+     * @param queueSize Number of commands that can wait in the queue.
+     * @param repeatInterval The same sound is not started again within this many samples.
+     * @param maxInstances Maximum number of voices playing the same sound.
+     */
+    Mixer(int voiceCount = 16, int queueSize = 64, std::uint64_t repeatInterval = 0, int maxInstances = 3);
+
+    Mixer(const Mixer&) = delete;
+    Mixer& operator=(const Mixer&) = delete;
+
+    /**
+     * @brief Adds a command to the queue. Called only by the game thread, it never blocks.
+     * @param command The command.
+     * @return Returns false if the queue is full (the command is dropped).
+     */
+    bool Push(const Command& command);
+
+    /**
+     * @brief Executes the queued commands, and adds the playing voices to the samples (with saturation).
+     * Called only by the audio thread.
+     * @param stream Samples that the voices are mixed into.
+     * @param count Number of samples.
+     */
+    void Mix(std::int16_t* stream, size_t count);
+
+    /**
+     * @brief Stops every voice playing the sound immediately. Called by the audio thread,
+     * or by another thread while the audio thread is locked out (before freeing the samples).
+     * @param sound Identifier of the sound.
+     */
+    void Stop(int sound);
+
+    /**
+     * @return Returns the number of playing voices (read it from the audio thread or while it is locked out).
+     */
+    int ActiveVoices() const;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Mixer();
+};
+
+#endif // MIXER_H
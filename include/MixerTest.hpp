@@ -0,0 +1,105 @@
+/** @file MixerTest.hpp
+  * @brief This file contains tests for the module Mixer
+  *
+  * For testing, it uses the gtest_lite.h library.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+# include <iostream>
+# include <vector>
+# include <cstdint>
+
+#include "gtest_lite.h"
+#include "Mixer.h"
+
+void TEST_Mixer() {
+    const std::vector<std::int16_t> low(8, 100), high(8, 30000);
+
+    /***** Checking Mixing *****/
+
+    // Checks whether the voices are added to the stream and stop at the end of the sound
+    TEST(Mixer, Mix) {
+        Mixer mixer(4, 8);
+        std::vector<std::int16_t> stream(6, 10);
+        EXPECT_TRUE(mixer.Push({ Mixer::Command::PLAY, low.data(), 4, 1, 0, false }));
+        mixer.Mix(stream.data(), stream.size());
+
+        EXPECT_EQ((std::int16_t) 110, stream[0]);
+        EXPECT_EQ((std::int16_t) 110, stream[3]);
+        EXPECT_EQ((std::int16_t) 10, stream[4]);
+        EXPECT_EQ(0, mixer.ActiveVoices());
+    } END
+
+    // Checks whether the sum is saturated instead of overflowing
+    TEST(Mixer, Saturation) {
+        Mixer mixer(4, 8);
+        std::vector<std::int16_t> stream(2, 10000);
+        mixer.Push({ Mixer::Command::PLAY, high.data(), 8, 1, 0, false });
+        mixer.Mix(stream.data(), stream.size());
+        EXPECT_EQ((std::int16_t) 32767, stream[0]);
+        EXPECT_EQ(1, mixer.ActiveVoices());
+    } END
+
+    // Checks whether a looped sound keeps playing until it is stopped
+    TEST(Mixer, Loop) {
+        Mixer mixer(4, 8);
+        std::vector<std::int16_t> stream(20, 0);
+        mixer.Push({ Mixer::Command::PLAY, low.data(), 3, 1, 0, true });
+        mixer.Mix(stream.data(), stream.size());
+        EXPECT_EQ((std::int16_t) 100, stream[19]);
+        EXPECT_EQ(1, mixer.ActiveVoices());
+
+        mixer.Push({ Mixer::Command::STOP, nullptr, 0, 0, 0, false });
+        mixer.Mix(stream.data(), stream.size());
+        EXPECT_EQ(0, mixer.ActiveVoices());
+    } END
+
+    /***** Checking the Voice Pool *****/
+
+    // Checks whether a full pool steals only voices with lower or equal priority
+    TEST(Mixer, Stealing) {
+        Mixer mixer(2, 8);
+        std::vector<std::int16_t> stream(1, 0);
+        mixer.Push({ Mixer::Command::PLAY, low.data(), 8, 1, 2, false });
+        mixer.Push({ Mixer::Command::PLAY, low.data(), 8, 2, 2, false });
+        mixer.Push({ Mixer::Command::PLAY, high.data(), 8, 3, 1, false });  // dropped: lower priority
+        mixer.Mix(stream.data(), stream.size());
+        EXPECT_EQ((std::int16_t) 200, stream[0]);
+
+        mixer.Push({ Mixer::Command::PLAY, high.data(), 8, 4, 3, false });  // steals a voice
+        stream[0] = 0;
+        mixer.Mix(stream.data(), stream.size());
+        EXPECT_EQ((std::int16_t) 30100, stream[0]);
+        EXPECT_EQ(2, mixer.ActiveVoices());
+    } END
+
+    // Checks whether the same sound is not restarted too often and has a limited number of instances
+    TEST(Mixer, RateLimit) {
+        Mixer rateLimited(8, 8, 4);
+        std::vector<std::int16_t> stream(2, 0);
+        rateLimited.Push({ Mixer::Command::PLAY, low.data(), 8, 1, 0, false });
+        rateLimited.Push({ Mixer::Command::PLAY, low.data(), 8, 1, 0, false });
+        rateLimited.Mix(stream.data(), stream.size());
+        EXPECT_EQ(1, rateLimited.ActiveVoices());
+
+        Mixer instanceLimited(8, 8, 0, 2);
+        for (int i = 0; i < 4; ++i)
+            instanceLimited.Push({ Mixer::Command::PLAY, low.data(), 8, 1, 0, false });
+        instanceLimited.Mix(stream.data(), stream.size());
+        EXPECT_EQ(2, instanceLimited.ActiveVoices());
+    } END
+
+    // Checks whether a full queue drops the command instead of blocking
+    TEST(Mixer, QueueFull) {
+        Mixer mixer(4, 2);
+        EXPECT_TRUE(mixer.Push({ Mixer::Command::PLAY, low.data(), 8, 1, 0, false }));
+        EXPECT_TRUE(mixer.Push({ Mixer::Command::PLAY, low.data(), 8, 2, 0, false }));
+        EXPECT_FALSE(mixer.Push({ Mixer::Command::PLAY, low.data(), 8, 3, 0, false }));
+
+        std::vector<std::int16_t> stream(1, 0);
+        mixer.Mix(stream.data(), stream.size());
+        EXPECT_TRUE(mixer.Push({ Mixer::Command::PLAY, low.data(), 8, 3, 0, false }));
+    } END
+}
@@ -0,0 +1,154 @@
+/** @file ParticleSystem.h
+  * @brief Class ParticleSystem updates and renders the particles of a level (coins, brick debris, enemy pops, laser trail).
+  *
+  * The particles are stored as a structure of arrays with a fixed capacity, so the update is a few
+  * simple loops over floats, and nothing is allocated while playing. All the particles are drawn from
+  * a single atlas texture with one SDL_RenderGeometry call.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef PARTICLE_SYSTEM_H
+#define PARTICLE_SYSTEM_H
+
+#ifndef CPORTA
+
+#include <SDL2/SDL.h>
+
+#include <iostream>
+#include <vector>
+#include <random>
+
+#include "Texture.h"
+
+/**
+ * @brief Fixed-capacity particle system of a level.
+ */
+class ParticleSystem {
+public:
+    enum Type { COIN=0, DEBRIS, POP, TRAIL, TYPE_COUNT };    ///< Type of the emitted particles.
+    static const size_t capacity = 512; ///< Static member: maximum number of living particles (new particles are dropped when it is full).
+
+private:
+    /**
+     * @brief Describes how the particles of a type look and behave.
+     */
+    struct Emitter {
+        float lifeTime; ///< Life time of a particle in seconds.
+        float gravity;  ///< Vertical acceleration in pixels per second squared.
+        SDL_Color colour;   ///< Colour of the particle (multiplied with the atlas).
+        bool fade;      ///< Contains whether the particle fades out by the end of its life time.
+    };
+    static const Emitter emitters[TYPE_COUNT];  ///< Static member: emitters indexed by the type of particle.
+    static const SDL_Rect frames[]; ///< Static member: source rectangles in the atlas (coin, four quarters of the brick, blank).
+    static const int atlasWidth;    ///< Static member: width of the atlas texture.
+    static const int atlasHeight;   ///< Static member: height of the atlas texture.
+
+    SDL_Texture* atlas; ///< Coin, brick and a blank square in a single texture (created when the particles are first rendered, so clones of a level never create it).
+    size_t count;       ///< Number of living particles (they are stored at the beginning of the arrays).
+    float x[capacity];  ///< x coordinate of the particles.
+    float y[capacity];  ///< y coordinate of the particles.
+    float vx[capacity]; ///< Horizontal velocity of the particles in pixels per second.
+    float vy[capacity]; ///< Vertical velocity of the particles in pixels per second.
+    float ay[capacity]; ///< Vertical acceleration of the particles.
+    float life[capacity];   ///< Remaining life time of the particles in seconds.
+    float width[capacity];  ///< Width of the particles.
+    float height[capacity]; ///< Height of the particles.
+    Uint8 type[capacity];   ///< Type of the particles.
+    Uint8 frame[capacity];  ///< Index of the source rectangle of the particles.
+    std::vector<SDL_Vertex> vertices;   ///< Vertices of the last rendered batch (reserved for the full capacity).
+    std::vector<int> indices;   ///< Indices of the quads (two triangles per particle, they never change).
+    std::minstd_rand random;    ///< Random generator of the spread (separate from the level, so the spawns of a simulation are not affected). Not seeded, the spread only has to look random.
+
+    /**
+     * @brief Adds a single particle if there is room for it.
+     * @param particleType Type of the particle.
+     * @param particleFrame Index of the source rectangle.
+     * @param rect Position and size of the particle.
+     * @param velocityX Horizontal velocity.
+     * @param velocityY Vertical velocity.
+     */
+    void Emit(Type particleType, Uint8 particleFrame, SDL_FRect rect, float velocityX, float velocityY);
+
+    /**
+     * @param min Lower bound.
+     * @param max Upper bound.
+     * @return Returns a random number between the bounds.
+     */
+    float Spread(float min, float max);
+
+    /**
+     * @brief Creates the atlas from the coin and block textures, and reserves the batch.
+     */
+    void CreateAtlas();
+
+public:
+    /**
+     * @brief Creates an empty particle system.
+     */
+    ParticleSystem();
+
+    ParticleSystem(const ParticleSystem&) = delete;
+    ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+    /**
+     * @brief Emits a coin jumping out of a block.
+     * @param x x coordinate of the middle of the block.
+     * @param y y coordinate of the top of the block.
+     */
+    void EmitCoin(int x, int y);
+
+    /**
+     * @brief Emits the four pieces of a broken brick block.
+     * @param x x coordinate of the block.
+     * @param y y coordinate of the block.
+     */
+    void EmitDebris(int x, int y);
+
+    /**
+     * @brief Emits a puff where an enemy was killed.
+     * @param x x coordinate of the enemy.
+     * @param y y coordinate of the enemy.
+     */
+    void EmitPop(int x, int y);
+
+    /**
+     * @brief Emits a single spark behind a laser.
+     * @param x x coordinate of the back of the laser.
+     * @param y y coordinate of the middle of the laser.
+     */
+    void EmitTrail(int x, int y);
+
+    /**
+     * @brief Moves the particles, and removes the expired ones.
+     * @param dt Delta time in milliseconds.
+     */
+    void Update(float dt);
+
+    /**
+     * @brief Renders the particles to the screen (renderer) in a single batch.
+     * @param cameraX How much the camera is shifted (to the right).
+     * @param renderer The particles are rendered onto this.
+     */
+    void Render(int cameraX, SDL_Renderer* renderer);
+
+    /**
+     * @brief Removes all the particles.
+     */
+    void Clear();
+
+    /**
+     * @return Returns the number of living particles.
+     */
+    size_t GetCount() const;
+
+    /**
+     * @brief Destructor.
+     */
+    ~ParticleSystem();
+};
+
+#endif // CPORTA
+
+#endif // PARTICLE_SYSTEM_H
@@ -0,0 +1,79 @@
+/** @file PerformanceConfig.h
+  * @brief Contains struct PerformanceConfig, the performance settings that can be tuned per machine without rebuilding.
+  *
+  * The settings are read from config.txt next to the executable (or from the
+  * file given with --config), then they can be overridden from the command
+  * line with the same names (e.g. --fps 60 --renderer software). The file
+  * contains "name = value" lines, everything after a '#' is a comment.
+  * Invalid lines are reported and ignored. A missing config.txt means defaults,
+  * but a file given with --config that cannot be opened is reported.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef PERFORMANCE_CONFIG_H
+#define PERFORMANCE_CONFIG_H
+
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Performance settings of the game.
+ */
+struct PerformanceConfig {
+    int fps = 100;          ///< Update cycles (and frames) per second (a cycle lasts exactly 1000/fps milliseconds, it is not rounded).
+    bool vsync = false;     ///< Contains whether the frames are locked to the vertical sync of the display (the update cycles still follow fps, a frame runs as many of them as the time passed).
+    bool software = false;  ///< Contains whether the software renderer is used instead of the accelerated one.
+    int width = 1600;       ///< Width of the window: the game (laid out for 1600x900) is rendered at this resolution.
+    int height = 900;       ///< Height of the window.
+    int audioBuffer = 256;  ///< Size of the audio buffer in samples (smaller means lower latency, but more frequent callbacks).
+    int voices = 16;        ///< Number of sound effects that can play at the same time.
+    int threads = 0;        ///< Number of the image decoder threads (0: chosen from the number of cores).
+
+    /**
+     * @brief Sets a single setting.
+     * @param name Name of the setting (fps, vsync, renderer, width, height, audio-buffer, voices, threads).
+     * @param value Value of the setting (vsync: on/off, renderer: accelerated/software, the rest are numbers).
+     * @param errors Invalid names and values are reported here.
+     * @return Returns whether the setting has been set.
+     */
+    bool Set(const std::string& name, const std::string& value, std::ostream& errors);
+
+    /**
+     * @brief Reads the settings from "name = value" lines.
+     * @param is Input stream.
+     * @param source Name of the source in the error messages (e.g. the path of the file).
+     * @param errors Invalid lines are reported here (and ignored).
+     * @return Returns the number of invalid lines.
+     */
+    int Load(std::istream& is, const std::string& source, std::ostream& errors);
+
+    /**
+     * @brief Reads the settings from a file. A missing file is only an error if it is required.
+     * @param path Path to the file.
+     * @param errors Invalid lines (and a required file that cannot be opened) are reported here.
+     * @param isRequired Contains whether the file has been given explicitly (e.g. with --config), so it has to exist.
+     * @return Returns the number of invalid lines (1 if a required file cannot be opened).
+     */
+    int LoadFile(const std::string& path, std::ostream& errors, bool isRequired = false);
+
+    /**
+     * @brief Overrides the settings from the command line ("--name value"). Other options are skipped.
+     * @param argc Number of the arguments.
+     * @param argv The arguments (the first one is the program).
+     * @param errors Invalid values are reported here (and ignored).
+     * @return Returns the number of invalid arguments.
+     */
+    int ParseArguments(int argc, const char* const argv[], std::ostream& errors);
+
+    /**
+     * @param argc Number of the arguments.
+     * @param argv The arguments (the first one is the program).
+     * @param defaultPath Path to the file if it is not given with --config.
+     * @return Returns the path to the config file.
+     */
+    static std::string GetPath(int argc, const char* const argv[], const std::string& defaultPath);
+};
+
+#endif // PERFORMANCE_CONFIG_H
@@ -0,0 +1,105 @@
+/** @file PerformanceConfigTest.hpp
+  * @brief This file contains tests for the module PerformanceConfig
+  *
+  * For testing, it uses the gtest_lite.h library.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+# include <iostream>
+# include <sstream>
+# include <string>
+
+#include "gtest_lite.h"
+#include "PerformanceConfig.h"
+
+void TEST_PerformanceConfig() {
+
+    /***** Checking the Config File *****/
+
+    // Checks whether the valid lines are applied and the invalid ones are ignored
+    TEST(PerformanceConfig, File) {
+        PerformanceConfig config;
+        std::stringstream file(
+            "# Slow machine\n"
+            "fps = 60\n"
+            "vsync=on   # tearing is worse than latency here\n"
+            "\n"
+            "renderer = software\n"
+            "width = 1280\n"
+            "height = 720\n"
+            "audio-buffer = 1000\n"
+            "voices = 8\n"
+            "threads = 1\n"
+            "colour = blue\n"
+            "fps 30\n");
+        std::stringstream errors;
+
+        EXPECT_EQ(3, config.Load(file, "config.txt", errors));
+        EXPECT_EQ(60, config.fps);
+        EXPECT_TRUE(config.vsync);
+        EXPECT_TRUE(config.software);
+        EXPECT_EQ(1280, config.width);
+        EXPECT_EQ(720, config.height);
+        EXPECT_EQ(256, config.audioBuffer);
+        EXPECT_EQ(8, config.voices);
+        EXPECT_EQ(1, config.threads);
+        EXPECT_NE(std::string::npos, errors.str().find("line 8"));
+    } END
+
+    // Checks whether a missing file is only reported if it has been given explicitly
+    TEST(PerformanceConfig, Missing File) {
+        PerformanceConfig config;
+        std::stringstream errors;
+
+        EXPECT_EQ(0, config.LoadFile("missing_config.txt", errors));
+        EXPECT_TRUE(errors.str().empty());
+        EXPECT_EQ(1, config.LoadFile("missing_config.txt", errors, true));
+        EXPECT_NE(std::string::npos, errors.str().find("missing_config.txt"));
+        EXPECT_EQ(100, config.fps);
+    } END
+
+    /***** Checking the Values *****/
+
+    // Checks whether the values out of range are rejected without changing the setting
+    TEST(PerformanceConfig, Values) {
+        PerformanceConfig config;
+        std::stringstream errors;
+
+        EXPECT_EQ(false, config.Set("fps", "0", errors));
+        EXPECT_EQ(false, config.Set("fps", "60hz", errors));
+        EXPECT_EQ(false, config.Set("voices", "100", errors));
+        EXPECT_EQ(false, config.Set("vsync", "yes", errors));
+        EXPECT_EQ(false, config.Set("renderer", "vulkan", errors));
+        EXPECT_EQ(100, config.fps);
+        EXPECT_EQ(16, config.voices);
+        EXPECT_EQ(false, config.vsync);
+        EXPECT_EQ(false, config.software);
+
+        EXPECT_TRUE(config.Set("audio-buffer", "2048", errors));
+        EXPECT_EQ(2048, config.audioBuffer);
+        EXPECT_TRUE(config.Set("renderer", "accelerated", errors));
+        EXPECT_EQ(false, config.software);
+    } END
+
+    /***** Checking the Command Line *****/
+
+    // Checks whether the command line overrides the settings and skips the other options
+    TEST(PerformanceConfig, Arguments) {
+        PerformanceConfig config;
+        config.fps = 60;
+        std::stringstream errors;
+        const char* argv[] = { "Cat-Mario", "--startup-report", "--fps", "144", "--config", "slow.txt",
+            "--vsync", "on", "--voices", "-1", "--threads" };
+
+        EXPECT_EQ(2, config.ParseArguments(11, argv, errors));
+        EXPECT_EQ(144, config.fps);
+        EXPECT_TRUE(config.vsync);
+        EXPECT_EQ(16, config.voices);
+        EXPECT_EQ(0, config.threads);
+
+        EXPECT_EQ(std::string("slow.txt"), PerformanceConfig::GetPath(11, argv, "config.txt"));
+        EXPECT_EQ(std::string("config.txt"), PerformanceConfig::GetPath(2, argv, "config.txt"));
+    } END
+}
@@ -0,0 +1,100 @@
+/** @file PixelCache.h
+  * @brief On-disk cache of decoded images, so that PNGs do not have to be decoded at every startup.
+  *
+  * A cache file contains a header and the pixels already converted to the
+  * renderer's native pixel format. The header stores the hash of the source
+  * file and the pixel format, so a cache file is ignored (and rewritten)
+  * automatically when the image changes or a different renderer is used.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef PIXEL_CACHE_H
+#define PIXEL_CACHE_H
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+/**
+ * @brief A single memory-mapped cache file.
+ */
+class PixelCache {
+public:
+    static const std::uint32_t version; ///< Static member: version of the cache file format.
+
+    /**
+     * @brief Header at the beginning of a cache file (followed by height * pitch bytes of pixels).
+     */
+    struct Header {
+        char magic[4];              ///< Always "CMTX".
+        std::uint32_t version;      ///< Version of the cache file format.
+        std::uint64_t sourceHash;   ///< Hash of the source image file.
+        std::uint32_t format;       ///< Pixel format of the pixels (SDL_PixelFormatEnum).
+        std::int32_t width;         ///< Width of the image in pixels.
+        std::int32_t height;        ///< Height of the image in pixels.
+        std::int32_t pitch;         ///< Length of a row of pixels in bytes.
+    };
+
+private:
+    const char* data;   ///< Beginning of the mapped file (nullptr if nothing is opened).
+    size_t size;        ///< Size of the mapped file in bytes.
+
+public:
+    /**
+     * @brief Creates an empty cache entry (nothing is opened).
+     */
+    PixelCache();
+
+    PixelCache(const PixelCache&) = delete;
+    PixelCache& operator=(const PixelCache&) = delete;
+
+    /**
+     * @brief Maps the cache file if it belongs to the given source and pixel format.
+     * @param path Path to the cache file.
+     * @param sourceHash Hash of the current source image file.
+     * @param format Expected pixel format.
+     * @return Returns false if the file is missing, outdated or corrupted.
+     */
+    bool Open(const std::string& path, std::uint64_t sourceHash, std::uint32_t format);
+
+    /**
+     * @brief Unmaps the cache file.
+     */
+    void Close();
+
+    /**
+     * @return Returns the header of the opened cache file.
+     */
+    const Header& GetHeader() const;
+
+    /**
+     * @return Returns the pixels of the opened cache file.
+     */
+    const void* GetPixels() const;
+
+    /**
+     * @brief Hashes the source file (64-bit FNV-1a).
+     * @param data Contents of the source file.
+     * @return Returns the hash.
+     */
+    static std::uint64_t Hash(std::string_view data);
+
+    /**
+     * @brief Writes a cache file. The file is written under a temporary name and renamed, so it is never seen half-written.
+     * @param path Path to the cache file.
+     * @param header Header of the cache file (magic and version are filled in).
+     * @param pixels Pixels (height * pitch bytes).
+     * @return Returns whether the file has been written.
+     */
+    static bool Store(const std::string& path, Header header, const void* pixels);
+
+    /**
+     * @brief Destructor: unmaps the cache file.
+     */
+    ~PixelCache();
+};
+
+#endif // PIXEL_CACHE_H
@@ -0,0 +1,62 @@
+/** @file PixelCacheTest.hpp
+  * @brief This file contains tests for the module PixelCache
+  *
+  * For testing, it uses the gtest_lite.h library.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+# include <iostream>
+# include <fstream>
+# include <string>
+# include <vector>
+# include <cstring>
+# include <cstdint>
+# include <filesystem>
+
+#include "gtest_lite.h"
+#include "PixelCache.h"
+
+void TEST_PixelCache() {
+    const std::string path = (std::filesystem::temp_directory_path() / "Cat-Mario-Test.tex").string();
+    const std::uint32_t format = 0x16362004;  // SDL_PIXELFORMAT_ARGB8888
+    std::vector<std::uint32_t> pixels = { 0xff000000, 0xffffffff, 0x00000000, 0x80ff0000, 0x12345678, 0x9abcdef0 };
+    std::uint64_t hash = PixelCache::Hash("png");
+
+    /***** Checking Hash *****/
+
+    // Checks the 64-bit FNV-1a reference values
+    TEST(PixelCache, Hash) {
+        EXPECT_EQ((std::uint64_t) 14695981039346656037ull, PixelCache::Hash(""));
+        EXPECT_EQ((std::uint64_t) 0xaf63dc4c8601ec8cull, PixelCache::Hash("a"));
+        EXPECT_FALSE(PixelCache::Hash("png") == PixelCache::Hash("pnG"));
+    } END
+
+    /***** Checking Store and Open *****/
+
+    // Checks whether the pixels are read back unchanged
+    TEST(PixelCache, RoundTrip) {
+        EXPECT_TRUE(PixelCache::Store(path, { {}, 0, hash, format, 3, 2, 12 }, pixels.data()));
+
+        PixelCache cache;
+        EXPECT_TRUE(cache.Open(path, hash, format));
+        EXPECT_EQ(3, cache.GetHeader().width);
+        EXPECT_EQ(2, cache.GetHeader().height);
+        EXPECT_EQ(12, cache.GetHeader().pitch);
+        EXPECT_EQ(0, std::memcmp(pixels.data(), cache.GetPixels(), pixels.size() * sizeof(std::uint32_t)));
+    } END
+
+    // Checks whether outdated and corrupted cache files are rejected
+    TEST(PixelCache, Invalidation) {
+        PixelCache cache;
+        EXPECT_FALSE(cache.Open(path, PixelCache::Hash("changed png"), format));
+        EXPECT_FALSE(cache.Open(path, hash, 0x16462004));   // SDL_PIXELFORMAT_RGBA8888
+        EXPECT_FALSE(cache.Open(path + ".missing", hash, format));
+
+        std::filesystem::resize_file(path, std::filesystem::file_size(path) - 4);
+        EXPECT_FALSE(cache.Open(path, hash, format));
+    } END
+
+    std::filesystem::remove(path);
+}
@@ -2,6 +2,7 @@
   * @brief Contains declarations of class: Font, RenderWindow, Button (and its derived classes), Transition
   * 
   * By using the SDL2 library, these classes allow us to create the GUI of the program.
+  * Text is drawn from the glyph atlases of the fonts (see GlyphAtlas).
   * 
   * @author Bácsi Miklós
   * @date 2025-05-18
@@ -19,9 +20,12 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
+#include <memory>
 
 #include "Texture.h"
+#include "GlyphAtlas.h"
 #include "LanguageModule.h"
 #include "Timer.h"
 
@@ -49,7 +53,10 @@ int GetRadiusFromFont(FontType font);
  */
 class Font {
 private:
-    std::vector<TTF_Font*> fonts;   ///< It stores the loaded fonts.
+    std::vector<TTF_Font*> fonts;   ///< It stores the loaded fonts (nullptr until a font is first used).
+    std::vector<std::string> paths; ///< Paths of the fonts relative to res/.
+    std::vector<int> sizes;         ///< Sizes of the fonts.
+    std::vector<std::unique_ptr<GlyphAtlas>> atlases;  ///< Glyph atlases of the fonts (created when they are first used).
 
 public:
     /**
@@ -58,18 +65,31 @@ public:
     Font();
 
     /**
-     * @brief Load a font with the given parameters.
-     * @param path File path of the font.
+     * @brief Sets the parameters of a font. It is opened when it is first used, so the fonts
+     * of the languages that are never selected are not opened at all.
+     * @param path Path of the font relative to res/ (see Assets).
+     * @param size Size of the font.
      * @param fontType Type of the font.
      */
     void LoadFont(const char* path, int size, FontType fontType);
 
     /**
      * @param font Type of the font.
-     * @return Returns a pointer to the asked font.
+     * @return Returns a pointer to the asked font (it is opened if it has not been used yet).
      */
     TTF_Font* GetFont(FontType font);
 
+    /**
+     * @param font Type of the font.
+     * @return Returns the glyph atlas of the asked font.
+     */
+    GlyphAtlas& GetAtlas(FontType font);
+
+    /**
+     * @brief Destroys the glyph atlases (before the renderer is destroyed).
+     */
+    void FreeAtlases();
+
     /**
      * @brief Destructor: closes the open fonts.
      */
@@ -86,24 +106,29 @@ public:
     static SDL_Renderer* renderer;  ///< Static member, renderer of the program.
 private:
     SDL_Window* window; ///< Pointer to the window.
-    int width;  ///< Width of the window.
-    int height; ///< Height of the window.
+    int width;  ///< Width of the window (in the coordinates of the game, see the constructor).
+    int height; ///< Height of the window (in the coordinates of the game, see the constructor).
     Font latinFonts;    ///< Contains the latin fonts (for English and Hungarian).
     Font japaneseFonts; ///< Contains the japanese fonts.
 
     /**
-     * @brief It loads all the fonts.
+     * @brief It sets the parameters of all the fonts (they are opened when they are first used).
      */
     void LoadFonts();
 
 public:
     /**
      * @brief Creates a new RenderWindow with given parameters.
+     * If the resolution differs from the size, the window has the given resolution and everything
+     * is still drawn in the coordinates of the given size, the renderer scales it (SDL_RenderSetLogicalSize).
      * @param title Title of the window.
-     * @param width Width of the window.
-     * @param height Height of the window.
+     * @param width Width of the window in the coordinates of the game.
+     * @param height Height of the window in the coordinates of the game.
+     * @param resolutionWidth Width of the window in pixels (0: the same as width).
+     * @param resolutionHeight Height of the window in pixels (0: the same as height).
+     * @param rendererFlags Flags of the renderer (SDL_RENDERER_ACCELERATED or SDL_RENDERER_SOFTWARE, and SDL_RENDERER_PRESENTVSYNC).
      */
-    RenderWindow(const char* title, int width, int height);
+    RenderWindow(const char* title, int width, int height, int resolutionWidth = 0, int resolutionHeight = 0, Uint32 rendererFlags = SDL_RENDERER_ACCELERATED);
 
     /**
      * @brief Clears the renderer (canvas).
@@ -116,7 +141,7 @@ public:
     void Display();
 
     /**
-     * @brief Renders text to the screen with given parameters. (Not really used because it creates and destroys the texture every time).
+     * @brief Renders text to the screen with given parameters. (It lays out the text every time, so it is not used for captions).
      * @param text Text to be displayed.
      * @param x x coordinate of the text.
      * @param y y coordinate of the text.
@@ -124,7 +149,7 @@ public:
      * @param font Type of the font.
      * @param language Language of the text.
      */
-    void RenderText(std::string text, int x, int y, Colour colour, FontType font, Language language);
+    void RenderText(std::string_view text, int x, int y, Colour colour, FontType font, Language language);
 
     /**
      * @brief Draws background to the screen with the given (or default) colours.
@@ -141,15 +166,20 @@ public:
     void ApplyTransition(int transparency);
 
     /**
-     * @return Returns the width of the window.
+     * @return Returns the width of the window (in the coordinates of the game).
      */
     int GetWidth() const;
 
     /**
-     * @return Returns the height of the window.
+     * @return Returns the height of the window (in the coordinates of the game).
      */
     int GetHeight() const;
 
+    /**
+     * @return Returns the refresh rate of the display showing the window (0 if it is unknown).
+     */
+    int GetRefreshRate() const;
+
     /**
      * @return Returns the renderer of the window.
      */
@@ -163,6 +193,14 @@ public:
      */
     TTF_Font* GetFont(FontType font, Language language);
 
+    /**
+     * @brief Returns the glyph atlas of the asked font. Necessary for rendering text.
+     * @param font Type of the font.
+     * @param language Language of the font.
+     * @return Returns the glyph atlas.
+     */
+    GlyphAtlas& GetAtlas(FontType font, Language language);
+
     /**
      * Destructor: destroy the window, the renderer, and calls SDL_Quit().
      */
@@ -176,7 +214,7 @@ public:
  */
 class Button {
 public:
-    enum Type { NONE=0, START, EXIT, PAUSE, CONTINUE, ENG, JP, HUN, LVL1, LVL2 };   ///< Type of buttons.
+    enum Type { NONE=0, START, EXIT, PAUSE, CONTINUE, ENG, JP, HUN, LEVEL, PREVIOUS_PAGE, NEXT_PAGE };   ///< Type of buttons.
     static RenderWindow* window;    ///< Static member: pointer to the window. Necessary for rendering and updating buttons.
 
 protected:
@@ -235,6 +273,13 @@ public:
      */
     void SetSelected(bool selected);
 
+    /**
+     * @brief Moves the button (the select box is not moved, so it is only for buttons that are not selected).
+     * @param x x coordinate of the button.
+     * @param y y coordinate of the button.
+     */
+    void SetPosition(int x, int y);
+
     /**
      * Destructor.
      */
@@ -250,7 +295,8 @@ class TextButton : public Button {
 private:
     std::string caption;    ///< Text of the button.
     Lang::CaptionType captionType;  ///< Caption type of the button.
-    SDL_Surface* surface;   ///< Surface of the button.
+    GlyphAtlas* atlas;  ///< Glyph atlas of the font in the current language.
+    GlyphAtlas::Layout layout;  ///< The caption laid out (only recalculated when the caption changes).
     FontType font;  ///< Font of the button.
     Colour colour;  ///< Colour of the button.
     const int backgroundOpacity;    ///< Background opacity of the backdrop.
@@ -260,6 +306,12 @@ private:
      */
     void DrawSelectBox();
 
+    /**
+     * @brief Lays out the caption, and sets the size of the button.
+     * @param language Language of the caption.
+     */
+    void Typeset(Language language);
+
 public:
     /**
      * @brief Creates a new TextButton withe given parameters.
@@ -299,7 +351,13 @@ public:
      * @param newCaption String.
      * @param newLanguage New language.
      */
-    void UpdateCaption(std::string newCaption, Language newLanguage);
+    void UpdateCaption(std::string_view newCaption, Language newLanguage);
+
+    /**
+     * @brief Reserves memory for captions of the given length, so updating the caption does not allocate.
+     * @param length Length of the longest caption in bytes.
+     */
+    void Reserve(size_t length);
 
     /**
      * @brief Destroys the buttons select box.
@@ -312,7 +370,7 @@ public:
     Lang::CaptionType GetCaptionType() const;
 
     /**
-     * @brief Destructor: deletes the surface.
+     * @brief Destructor.
      */
     ~TextButton();
 };
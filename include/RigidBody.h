@@ -9,6 +9,8 @@
 
 #include <iostream>
 
+#include "Fixed.h"
+
 /**
  * @brief Vector2D encapsulates x and y coordinates, and is used for mathematical calculations.
  */
@@ -218,6 +220,10 @@ struct Vector2D {
 
 /**
  * @brief Models an object on which we can apply basic physics operations.
+ *
+ * The velocity and the sub-pixel position (the state that is carried from one update to the next) are stored in fixed-point,
+ * so they are advanced and damped by integer arithmetic. Only the inputs (force, mass, delta time) are floats: the velocity
+ * change of an update is computed from them and converted once, and the velocity is converted back only when it is read.
  */
 class RigidBody {
     friend class GameEngine;
@@ -229,8 +235,11 @@ private:
     float mass; ///< mass of the object.
     Vector2D force;     ///< Resultant force (without gravity).
     Vector2D position;  ///< Position coordinate of the object.
-    Vector2D velocity;  ///< Velocity of the object.
-    Vector2D acceleration;  ///< Acceleration of the object.
+    Fixed velocityX;    ///< Velocity of the object in the x direction.
+    Fixed velocityY;    ///< Velocity of the object in the y direction.
+    Vector2D acceleration;  ///< Acceleration of the object (computed from the force in every update, it is not accumulated).
+    Fixed subPixelX;    ///< Displacement in the x direction that has not been taken by MoveX() yet.
+    Fixed subPixelY;    ///< Displacement in the y direction that has not been taken by MoveY() yet.
 
 public:
     /**
@@ -250,6 +259,18 @@ public:
      */
     const Vector2D& GetPosition() const;
 
+    /**
+     * @brief Moves the coordinate by the whole pixels of the accumulated displacement, and keeps the fraction for the next update.
+     * @param x Reference to the x coordinate (e.g. of a hit box).
+     */
+    void MoveX(int& x);
+
+    /**
+     * @brief Moves the coordinate by the whole pixels of the accumulated displacement, and keeps the fraction for the next update.
+     * @param y Reference to the y coordinate (e.g. of a hit box).
+     */
+    void MoveY(int& y);
+
     /**
      * @brief Applys the given force to the rigid body (overriding previous one).
      * @param F Force that is applied to the object.
@@ -270,16 +291,32 @@ public:
 
     /**
      * @brief Applys the given velocity in the x direction to the rigid body (overriding previous one).
+     * Stopping the object (0.0f) also drops the fraction of a pixel that it has not moved yet.
      * @param vx Velocity that is applied to the object.
      */
     void ApplyVelocityX(float vx);
 
     /**
      * @brief Applys the given velocity in the y direction to the rigid body (overriding previous one).
+     * Stopping the object (0.0f) also drops the fraction of a pixel that it has not moved yet.
      * @param vy Velocity that is applied to the object.
      */
     void ApplyVelocityY(float vy);
 
+    /**
+     * @brief Moves the object at the given constant velocity without any force or gravity (e.g. a laser, or the player sliding down a flag).
+     * The velocity is set, and its displacement is accumulated like in Update (see MoveX and MoveY).
+     * @param velocity Velocity of the object.
+     * @param dt Delta time.
+     */
+    void Drift(Vector2D velocity, float dt);
+
+    /**
+     * @brief Multiplies the velocity by the given factor in fixed-point (e.g. friction).
+     * @param factor Multiplier of the velocity.
+     */
+    void ScaleVelocity(Fixed factor);
+
     /**
      * @brief Resets the rigid body to the default state.
      */
@@ -301,9 +338,9 @@ public:
     Vector2D& Position();
 
     /**
-     * @return Returns reference to the velocity of the object.
+     * @return Returns the velocity of the object (converted from fixed-point, change it with ApplyVelocityX/Y or ScaleVelocity).
      */
-    Vector2D& Velocity();
+    Vector2D Velocity() const;
 
     /**
      * @return Returns reference to the acceleration of the object.
@@ -345,4 +345,77 @@ void  TEST_RigidBody() {
         EXPECT_FLOAT_EQ(0.0f, body2.GetPosition().x);
         EXPECT_FLOAT_EQ(40.0f, body2.GetPosition().y);
     } END
-}
\ No newline at end of file
+
+    TEST(RigidBody, 'Sub-pixel movement') {
+        RigidBody body;
+        body.ApplyForceY(-1.0f * RigidBody::gravity);
+        body.ApplyVelocityX(0.25f);
+        int x = 0, y = 0;
+        for (int i = 0; i < 3; ++i) {
+            body.Update(1.0f);
+            body.MoveX(x);
+            body.MoveY(y);
+        }
+        EXPECT_EQ(0, x);
+        // The fractions add up to a whole pixel
+        body.Update(1.0f);
+        body.MoveX(x);
+        body.MoveY(y);
+        EXPECT_EQ(1, x);
+        EXPECT_EQ(0, y);
+
+        // Moving to the left is rounded down, and the fraction is kept
+        body.ApplyVelocityX(-0.25f);
+        body.Update(1.0f);
+        body.MoveX(x);
+        EXPECT_EQ(0, x);
+        body.Update(1.0f);
+        body.Update(1.0f);
+        body.Update(1.0f);
+        body.MoveX(x);
+        EXPECT_EQ(0, x);
+        body.Update(1.0f);
+        body.MoveX(x);
+        EXPECT_EQ(-1, x);
+
+        // Stopping drops the fraction
+        body.ApplyVelocityX(0.75f);
+        body.Update(1.0f);
+        body.ApplyVelocityX(0.0f);
+        body.Update(1.0f);
+        body.MoveX(x);
+        EXPECT_EQ(-1, x);
+    } END
+
+    TEST(RigidBody, 'Scale Velocity') {
+        RigidBody body;
+        body.ApplyVelocityX(-0.5f);
+        body.ApplyVelocityY(0.25f);
+        body.ScaleVelocity(Fixed(1) / Fixed(2));
+        EXPECT_FLOAT_EQ(-0.25f, body.Velocity().x);
+        EXPECT_FLOAT_EQ(0.125f, body.Velocity().y);
+
+        // Damping stops the body in both directions (the velocity is rounded towards zero)
+        for (int i = 0; i < 200; ++i)
+            body.ScaleVelocity(Fixed(9) / Fixed(10));
+        EXPECT_FLOAT_EQ(0.0f, body.Velocity().x);
+        EXPECT_FLOAT_EQ(0.0f, body.Velocity().y);
+    } END
+
+    TEST(RigidBody, 'Drift') {
+        // A speed that is not a whole number of pixels per update is not truncated (6.94 ms at 144 Hz),
+        // only the fixed-point rounding of the step may lose a pixel over a second
+        RigidBody body;
+        body.ApplyForceY(-10.0f);
+        int x = 0, y = 0;
+        for (int i = 0; i < 144; ++i) {
+            body.Drift(Vector2D(2.0f, -0.2f), 1000.0f / 144.0f);
+            body.MoveX(x);
+            body.MoveY(y);
+        }
+        EXPECT_EQ(1999, x);
+        EXPECT_EQ(-200, y);
+        EXPECT_FLOAT_EQ(2.0f, body.Velocity().x);
+        EXPECT_FLOAT_EQ(0.0f, body.Force().y);
+    } END
+}
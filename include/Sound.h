@@ -1,10 +1,22 @@
 /** @file Sound.h
   * @brief Allows us to play sounds using SDL2's Mixer library.
-  * 
-  * SDL supports only 8 channels.
-  * Channel 7 is reserved for playing background and lobby music.
-  * Stopping looped channel is buggy, so an empty audio is play on that channel.
-  * 
+  *
+  * Sound effects are not played on SDL_mixer's channels: they are mixed by
+  * class Mixer on a pool of voices with priorities, hooked in after SDL_mixer
+  * (Mix_SetPostMix). PlaySound only puts a command in Mixer's lock-free queue,
+  * so the game never waits for the audio device. The audio buffer is small
+  * (256 samples by default), so a sound starts within a few milliseconds.
+  *
+  * Background and lobby music are streamed
+  * with Mix_Music (decoded piece by piece while playing), so multi-minute
+  * tracks are never held in memory as PCM. Changing the music fades the
+  * current track out and the next one in.
+  *
+  * Sound effects are loaded by a background thread in the order they are requested,
+  * so the title screen appears without waiting for the MP3s to be decoded.
+  * The decoded PCM is written to the cache directory (see PixelCache), so
+  * later startups only map the cache files and do not decode at all.
+  *
   * @author Bácsi Miklós
   * @date 2025-05-18
 */
@@ -19,8 +31,15 @@
 
 #include <iostream>
 #include <vector>
+#include <string>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 
-#define MAX_CHANNELS 8
+#include "PixelCache.h"
+#include "Mixer.h"
 
 /**
  * @brief Sound module.
@@ -29,40 +48,118 @@ class Sound {
 public:
     enum Type {CLICK=0, HAL, SAKANA, BACKGROUND, DEATH, JUMP, ROAR, BREAK, COIN, LASER, FISH, LOBBY, POP, FLAG, ERROR, EMPTY, COUNT=16};    ///< Type of sounds.
 private:
-    std::vector<Mix_Chunk*> sounds;     ///< Contains all the sounds.
+    static const int fadeTime;  ///< Static member: duration of fading the music in or out in milliseconds.
+    static const int repeatTime;    ///< Static member: the same sound effect is not started again within this many milliseconds.
+    static const int priorities[];  ///< Static member: priority of every sound effect (a sound can steal the voice of a sound with lower or equal priority).
+
+    std::unique_ptr<Mixer> mixer;   ///< Mixes the sound effects (created when the audio device is opened).
+
+    std::vector<Mix_Chunk*> sounds;     ///< Contains all the sound effects (nullptr while a sound is being loaded).
+    std::vector<std::unique_ptr<PixelCache>> caches;    ///< Mapped cache files that the chunks of the cached sounds point into.
+    std::vector<std::string> paths;     ///< Paths of the requested sounds (empty if a sound has not been requested).
+    std::vector<bool> isFailed;         ///< Contains whether a sound has failed to load (it is never played).
+    std::vector<bool> isFailureReported;    ///< Contains whether playing a failed sound has been reported (only the first request is).
+    std::deque<Sound::Type> queue;      ///< Sounds waiting for the loader thread.
+    bool isDecoding;            ///< Contains whether the loader thread is decoding a sound.
+    Sound::Type pendingLoop;    ///< Looped sound that is played as soon as it is loaded (COUNT if there is none).
+    bool isStopping;            ///< Tells the loader thread to exit.
+    std::mutex mutex;           ///< Guards every member above (never held while decoding).
+    std::condition_variable wakeUp;     ///< Wakes up the loader thread when a sound is requested.
+    std::thread loader;         ///< Loads the requested sounds one by one.
+    std::vector<Mix_Music*> musics;     ///< Contains the streamed music (nullptr for sound effects). Used only by the main thread.
+    Sound::Type nextMusic;      ///< Music that starts when the current one has faded out (COUNT if there is none).
+    int nextMusicLoops;         ///< Number of times the next music is played (-1: looped forever).
+
     void FreeSound(Sound::Type soundType);  ///< Frees a sound by type.
 
+    /**
+     * @brief Main function of the loader thread.
+     */
+    void LoadQueuedSounds();
+
+    /**
+     * @brief Reads the decoded sound from the cache, or decodes it and writes the cache.
+     * @param path Path to the sound relative to res/ (see Assets).
+     * @param cache The mapped cache file is stored here (the returned chunk points into it).
+     * @return Returns the loaded sound (nullptr on failure).
+     */
+    static Mix_Chunk* DecodeSound(const std::string& path, std::unique_ptr<PixelCache>& cache);
+
+    /**
+     * @brief Fades in the music, or fades out the current music first if there is one.
+     * @param soundType Type of the music.
+     * @param loop Contains whether the music is looped.
+     */
+    void PlayMusic(Sound::Type soundType, bool loop);
+
+    /**
+     * @param soundType Type of the sound.
+     * @return Returns whether the sound is streamed music (BACKGROUND or LOBBY).
+     */
+    static bool IsMusic(Sound::Type soundType);
+
+    /**
+     * @brief Callback of SDL_mixer (in the audio thread): mixes the sound effects into the mixed music.
+     * @param mixer Pointer to the Mixer.
+     * @param stream The audio buffer.
+     * @param length Length of the buffer in bytes.
+     */
+    static void MixEffects(void* mixer, Uint8* stream, int length);
+
 public:
-    /** 
-     * @brief Default constructor.
+    /**
+     * @brief Initialises SDL's audio subsystem and opens the audio device.
+     * @param bufferSize Size of the audio buffer in samples (smaller means lower latency, but more frequent callbacks).
+     * @param voiceCount Number of sound effects that can play at the same time (see Mixer).
      */
-    Sound();
+    Sound(int bufferSize = 256, int voiceCount = 16);
 
-    /** 
-     * @brief Loads a sound from path to a type.
-     * @param path File path to the sound.
+    Sound(const Sound&) = delete;
+    Sound& operator=(const Sound&) = delete;
+
+    /**
+     * @brief Requests a sound from path to a type. Sound effects are loaded in the background, in the order of the requests,
+     * music is only opened for streaming.
+     * @param path Path to the sound relative to res/ (see Assets).
      * @param soundType Type of the sound.
      */
     void LoadSound(const char* path, Sound::Type soundType);
 
-    /** 
-     * @brief Plays a sound by type.
+    /**
+     * @brief Plays a sound by type. It never waits for the loader: a sound that is still loading is moved
+     * to the front of the queue, and it is skipped (or started when it is loaded if it is looped).
+     * A sound that has failed to load is skipped, and the first request for it is reported.
      * @param soundType Type of the sound.
      * @param loop Contains whether the sound is looped.
      */
     void PlaySound(Sound::Type soundType, bool loop = false);
 
-    /** 
-     * @brief Stops all sounds.
+    /**
+     * @brief Fades out the music (sound effects are not stopped).
      */
     void StopSound();
 
-    /** 
-     * @brief Destructor.
+    /**
+     * @brief Starts the next music when the previous one has faded out. Called once per frame.
+     */
+    void Update();
+
+    /**
+     * @return Returns whether the loader thread has sounds left to load.
+     */
+    bool IsLoading();
+
+    /**
+     * @return Returns the number of sound effects that have failed to load.
+     */
+    int GetFailedCount();
+
+    /**
+     * @brief Destructor. Stops the loader thread.
      */
     ~Sound();
 };
 
 #endif // CPORTA
 
-#endif // SOUND_H
\ No newline at end of file
+#endif // SOUND_H
@@ -0,0 +1,146 @@
+/** @file StartupReport.h
+  * @brief Contains class StartupReport, which measures where the time of the startup goes.
+  *
+  * Every piece of the startup (initialising SDL, creating the window, decoding
+  * an image, uploading a texture, building the buttons...) is recorded with the
+  * thread it ran on. The startup is finished when the deferred pieces and the
+  * background loaders are done; after that nothing is recorded. Run the game
+  * with --startup-report to print the breakdown.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef STARTUP_REPORT_H
+#define STARTUP_REPORT_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <mutex>
+#include <chrono>
+
+/**
+ * @brief Collects the timed phases of the startup from every thread.
+ */
+class StartupReport {
+public:
+    typedef std::chrono::steady_clock Clock;    ///< Clock of the measurements.
+
+    /**
+     * @brief A single timed piece of the startup (or a milestone, which has no duration).
+     */
+    struct Phase {
+        std::string name;   ///< Name of the phase.
+        std::string thread; ///< Name of the thread it ran on (empty for milestones).
+        double start;       ///< Start of the phase in milliseconds since the beginning of the startup.
+        double duration;    ///< Duration of the phase in milliseconds.
+    };
+
+    /**
+     * @brief Records a phase for its lifetime.
+     */
+    class Scope {
+    private:
+        StartupReport& report;  ///< The report the phase is added to.
+        std::string name;       ///< Name of the phase.
+        std::string thread;     ///< Name of the thread.
+        Clock::time_point begin;    ///< Beginning of the phase.
+
+    public:
+        /**
+         * @brief Starts the phase.
+         * @param name Name of the phase.
+         * @param thread Name of the thread.
+         * @param report The report the phase is added to.
+         */
+        Scope(const std::string& name, const std::string& thread = "main", StartupReport& report = StartupReport::Instance());
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        /**
+         * @brief Destructor: adds the phase to the report.
+         */
+        ~Scope();
+    };
+
+private:
+    Clock::time_point origin;   ///< Beginning of the startup.
+    std::vector<Phase> phases;  ///< Recorded phases in the order they were added.
+    bool isFinished;    ///< Contains whether the startup is finished (nothing is recorded after it).
+    std::mutex mutex;   ///< Guards every member above (phases are added by the loader threads too).
+
+    /**
+     * @param time A point in time.
+     * @return Returns the milliseconds elapsed from the beginning of the startup to the given time.
+     */
+    double Since(Clock::time_point time) const;
+
+public:
+    /**
+     * @brief Starts a report.
+     * @param origin Beginning of the startup.
+     */
+    StartupReport(Clock::time_point origin = Clock::now());
+
+    StartupReport(const StartupReport&) = delete;
+    StartupReport& operator=(const StartupReport&) = delete;
+
+    /**
+     * @return Returns the report of the program (its startup begins when it is first used).
+     */
+    static StartupReport& Instance();
+
+    /**
+     * @brief Adds a phase (ignored if the startup is finished).
+     * @param name Name of the phase.
+     * @param thread Name of the thread.
+     * @param begin Beginning of the phase.
+     * @param end End of the phase.
+     */
+    void Add(const std::string& name, const std::string& thread, Clock::time_point begin, Clock::time_point end);
+
+    /**
+     * @brief Adds a milestone (e.g. the title screen has been shown).
+     * @param name Name of the milestone.
+     * @param time When it has been reached.
+     */
+    void Mark(const std::string& name, Clock::time_point time = Clock::now());
+
+    /**
+     * @brief Finishes the startup: adds a "startup finished" milestone, later phases are ignored.
+     * @param time End of the startup.
+     */
+    void Finish(Clock::time_point time = Clock::now());
+
+    /**
+     * @return Returns whether the startup is finished.
+     */
+    bool IsFinished();
+
+    /**
+     * @return Returns the phases and milestones ordered by their start.
+     */
+    std::vector<Phase> GetPhases();
+
+    /**
+     * @param name Name of the milestone.
+     * @return Returns the time of the milestone in milliseconds since the beginning of the startup (-1 if it has not been reached).
+     */
+    double GetMilestone(const std::string& name);
+
+    /**
+     * @param thread Name of the thread.
+     * @return Returns the time the thread has spent in its phases in milliseconds (overlapping phases are counted once).
+     */
+    double GetBusyTime(const std::string& thread);
+
+    /**
+     * @brief Prints the phases ordered by their start, then the busy time of every thread.
+     * @param os Output stream.
+     */
+    void Print(std::ostream& os);
+};
+
+#endif // STARTUP_REPORT_H
@@ -0,0 +1,94 @@
+/** @file StartupReportTest.hpp
+  * @brief This file contains tests for the module StartupReport
+  *
+  * For testing, it uses the gtest_lite.h library.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+# include <iostream>
+# include <sstream>
+# include <string>
+# include <vector>
+# include <thread>
+# include <chrono>
+
+#include "gtest_lite.h"
+#include "StartupReport.h"
+
+void TEST_StartupReport() {
+    typedef StartupReport::Clock Clock;
+    typedef std::chrono::milliseconds ms;
+
+    /***** Checking the Phases *****/
+
+    // Checks whether the phases are ordered by their start and summed per thread
+    TEST(StartupReport, Phases) {
+        Clock::time_point origin = Clock::now();
+        StartupReport report(origin);
+        report.Add("img/MenuScreen.png", "decoder 1", origin + ms(20), origin + ms(50));
+        report.Add("SDL_Init", "main", origin, origin + ms(10));
+        report.Add("window", "main", origin + ms(10), origin + ms(15));
+
+        std::vector<StartupReport::Phase> phases = report.GetPhases();
+        EXPECT_EQ((size_t) 3, phases.size());
+        EXPECT_EQ(std::string("SDL_Init"), phases[0].name);
+        EXPECT_EQ(std::string("window"), phases[1].name);
+        EXPECT_EQ(std::string("decoder 1"), phases[2].thread);
+        EXPECT_DOUBLE_EQ(20.0, phases[2].start);
+        EXPECT_DOUBLE_EQ(30.0, phases[2].duration);
+
+        EXPECT_DOUBLE_EQ(15.0, report.GetBusyTime("main"));
+        EXPECT_DOUBLE_EQ(30.0, report.GetBusyTime("decoder 1"));
+        EXPECT_DOUBLE_EQ(0.0, report.GetBusyTime("sounds"));
+
+        // A phase within an other one is not counted again
+        report.Add("img/FlagENG.png", "main", origin + ms(11), origin + ms(13));
+        report.Add("menu captions", "main", origin + ms(14), origin + ms(20));
+        EXPECT_DOUBLE_EQ(20.0, report.GetBusyTime("main"));
+    } END
+
+    /***** Checking the Milestones *****/
+
+    // Checks whether nothing is recorded after the startup is finished
+    TEST(StartupReport, Milestones) {
+        Clock::time_point origin = Clock::now();
+        StartupReport report(origin);
+        EXPECT_DOUBLE_EQ(-1.0, report.GetMilestone("title screen shown"));
+
+        report.Mark("title screen shown", origin + ms(100));
+        report.Add("menu screen", "main", origin + ms(110), origin + ms(115));
+        report.Finish(origin + ms(200));
+        report.Add("late phase", "main", origin + ms(300), origin + ms(400));
+
+        EXPECT_TRUE(report.IsFinished());
+        EXPECT_DOUBLE_EQ(100.0, report.GetMilestone("title screen shown"));
+        EXPECT_DOUBLE_EQ(200.0, report.GetMilestone("startup finished"));
+        EXPECT_DOUBLE_EQ(5.0, report.GetBusyTime("main"));
+        EXPECT_EQ((size_t) 3, report.GetPhases().size());
+
+        std::ostringstream os;
+        report.Print(os);
+        EXPECT_NE(std::string::npos, os.str().find("title screen shown"));
+        EXPECT_EQ(std::string::npos, os.str().find("late phase"));
+    } END
+
+    /***** Checking the Threads *****/
+
+    // Checks whether the phases of several threads are all recorded
+    TEST(StartupReport, Threads) {
+        StartupReport report;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t)
+            threads.emplace_back([&report, t]() {
+                for (int i = 0; i < 100; ++i)
+                    StartupReport::Scope scope("phase", "decoder " + std::to_string(t + 1), report);
+            });
+        for (std::thread& thread : threads)
+            thread.join();
+
+        EXPECT_EQ((size_t) 400, report.GetPhases().size());
+        EXPECT_TRUE(report.GetBusyTime("decoder 4") >= 0.0);
+    } END
+}
@@ -15,6 +15,7 @@
 #include <iostream>
 #include <string>
 
+#include "ImageLoader.h"
 
 /** 
  * @brief Class Texture containing texture, srcRect and destRect.
@@ -22,15 +23,41 @@
 class Texture {
 public:
     static SDL_Renderer* renderer; ///< Static member, necessary for rendering the textures.
+    static ImageLoader* loader;    ///< Static member, the images requested from it are decoded in the background (nullptr: every image is decoded when it is loaded).
     /** 
      * @brief Loads a static texture from path.
-     * @param path Path to the texture.
+     * @param path Path to the texture relative to res/ (see Assets).
      * @see SDL_Texture
      * @return Return loaded texture.
      */
     static SDL_Texture* LoadStaticTexture(std::string path);
 
+    /**
+     * @return Returns the renderer's native pixel format (with alpha channel).
+     */
+    static Uint32 GetNativeFormat();
+
 private:
+    static Uint32 nativeFormat; ///< Static member, the renderer's native pixel format (necessary for the texture cache).
+
+    /**
+     * @brief Creates a texture from the image decoded by the loader. If it has not been requested from the loader,
+     * the image is decoded here (see ImageLoader::Decode).
+     * @param path Path to the texture relative to res/ (see Assets).
+     * @return Returns the created texture (nullptr if it failed).
+     */
+    static SDL_Texture* CreateTexture(const std::string& path);
+
+    /**
+     * @brief Creates a static texture and uploads the pixels with SDL_UpdateTexture.
+     * @param width Width of the image in pixels.
+     * @param height Height of the image in pixels.
+     * @param pixels Pixels in the native pixel format.
+     * @param pitch Length of a row of pixels in bytes.
+     * @return Returns the created texture (nullptr if it failed).
+     */
+    static SDL_Texture* UploadPixels(int width, int height, const void* pixels, int pitch);
+
     SDL_Texture* texture;   ///< Pointer to texture.
     SDL_Rect srcRect;       ///< Source rectangle for the Texture.
     SDL_Rect destRect;      ///< Destination rectangle for the Texture.
@@ -45,7 +72,7 @@ public:
 
     /** 
      * @brief Constructor.
-     * @param path Path to the texture.
+     * @param path Path to the texture relative to res/ (see Assets).
      * @param rect Rectangles (source, destination).
      * @param isStatic Contains whether texture is static.
      * @see SDL_Rect
@@ -54,7 +81,7 @@ public:
 
     /** 
      * @brief Constructor.
-     * @param path Path to the texture.
+     * @param path Path to the texture relative to res/ (see Assets).
      * @param srcRect Source rectangle for the Texture.
      * @param destRect Destination rectangle for the Texture.
      * @param isStatic Contains whether texture is static.
@@ -79,7 +106,7 @@ public:
 
     /**
      * @brief Loads a texture from file path.
-     * @param path Path to texture.
+     * @param path Path to texture relative to res/ (see Assets).
      */
     void LoadTexture(std::string path);
 
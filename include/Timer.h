@@ -21,6 +21,7 @@ private:
     bool isActive;      ///< Contains whether timer is active.
     Uint32 startTicks;  ///< Contains the start of the timer.
     size_t setDuration; ///< Contains the set duration of the timer.
+    Uint32 (*clock)();  ///< Source of the time in milliseconds (SDL_GetTicks by default).
 
 public:
     /**
@@ -34,6 +35,12 @@ public:
      */
     Timer(size_t milliSeconds);
 
+    /**
+     * @brief Constructor with a custom source of time (e.g. the simulated time of the world).
+     * @param clock Function that returns the current time in milliseconds.
+     */
+    Timer(Uint32 (*clock)());
+
     /**
      * @brief Deactivates the timer.
      */
@@ -0,0 +1,67 @@
+/** @file World.h
+  * @brief Contains the simulation state that belongs to a single level (world).
+  *
+  * Every Level owns a World, and the world of the level that is being
+  * simulated is bound to the current thread. This way several levels can
+  * be simulated at the same time on separate threads (e.g. for batch
+  * playtesting), while the game objects still reach the state of their
+  * own world without having a pointer to it. The world also stores the
+  * components of the game objects, so copying a world copies their state.
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef WORLD_H
+#define WORLD_H
+
+#ifndef CPORTA
+
+#include <SDL2/SDL.h>
+
+#include <iostream>
+
+#include "Components.h"
+
+/**
+ * @brief Simulation state of a single level.
+ */
+struct World {
+    SDL_Rect screen;        ///< Represents how the screen (camera) is moved.
+    int playerPosition;     ///< x coordinate + width of the player's hit box (necessary for activating e.g. Fish or Laser).
+    bool isCompleted;       ///< Contains whether the level has been completed.
+    Uint32 time;            ///< Simulated time in whole milliseconds (the whole part of exactTime).
+    double exactTime;       ///< Simulated time in milliseconds with its fraction (advanced by every update of the level, so a fractional step, e.g. 16.67 ms, is not truncated).
+    Components components;  ///< Components of the game objects of the level (the objects only store their id).
+
+    /**
+     * @brief Creates a world with the camera at the beginning of the level. The screen has the size of the window (1600x900).
+     */
+    World();
+
+    /**
+     * @return Returns the world that is bound to the current thread (an empty world if none is bound).
+     */
+    static World& Current();
+
+    /**
+     * @return Returns the simulated time of the world that is bound to the current thread (usable as a clock of Timer).
+     */
+    static Uint32 Time();
+
+    /**
+     * @brief Binds the world to the current thread.
+     * @param world Reference to the world.
+     */
+    static void Bind(World& world);
+
+    /**
+     * @brief Unbinds the world from the current thread if it is bound (necessary before destroying it).
+     * @param world Reference to the world.
+     */
+    static void Unbind(World& world);
+};
+
+#endif // CPORTA
+
+#endif // WORLD_H
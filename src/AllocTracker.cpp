@@ -0,0 +1,124 @@
+/** @file AllocTracker.cpp
+  * @brief Contains the implementation of AllocTracker.h (and the replaced operator new and delete with -DALLOC_TRACK)
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#include <iostream>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#include "AllocTracker.h"
+
+thread_local AllocTracker::Entry AllocTracker::entries[AllocTracker::maxScopes];
+thread_local size_t AllocTracker::entryCount = 1;
+thread_local size_t AllocTracker::current = 0;
+
+/***** Class Scope *****/
+AllocTracker::Scope::Scope(const char* name, bool expected) : previous(AllocTracker::current) {
+    AllocTracker::current = AllocTracker::Find(name, expected);
+}
+
+AllocTracker::Scope::~Scope() { AllocTracker::current = previous; }
+/* ************************************************************************************ */
+
+/***** Class AllocTracker *****/
+void AllocTracker::Record(size_t bytes) {
+    Entry& entry = entries[current];
+    ++entry.frame.allocations;
+    entry.frame.bytes += bytes;
+    ++entry.total.allocations;
+    entry.total.bytes += bytes;
+}
+
+void AllocTracker::BeginFrame() {
+    for (size_t i = 0; i < entryCount; ++i)
+        entries[i].frame = Counter();
+}
+
+AllocTracker::Counter AllocTracker::GetFrame(bool includeExpected) {
+    Counter sum;
+    for (size_t i = 0; i < entryCount; ++i) {
+        if (entries[i].expected && includeExpected == false)
+            continue;
+        sum.allocations += entries[i].frame.allocations;
+        sum.bytes += entries[i].frame.bytes;
+    }
+    return sum;
+}
+
+AllocTracker::Counter AllocTracker::GetFrame(const char* name) {
+    for (size_t i = 1; i < entryCount; ++i)
+        if (std::strcmp(entries[i].name, name) == 0)
+            return entries[i].frame;
+    return Counter();
+}
+
+void AllocTracker::ReportFrame(std::ostream& os) {
+    for (size_t i = 0; i < entryCount; ++i)
+        if (entries[i].frame.allocations > 0)
+            os << "  " << (entries[i].name != nullptr ? entries[i].name : "(no scope)") << ": " << entries[i].frame.allocations
+                << " allocations, " << entries[i].frame.bytes << " bytes" << (entries[i].expected ? " (cache)" : "") << std::endl;
+}
+
+void AllocTracker::Report(std::ostream& os) {
+    os << "Allocations of the thread:" << std::endl;
+    for (size_t i = 0; i < entryCount; ++i)
+        os << "  " << (entries[i].name != nullptr ? entries[i].name : "(no scope)") << ": " << entries[i].total.allocations
+            << " allocations, " << entries[i].total.bytes << " bytes" << std::endl;
+}
+/* ************************************************************************************ */
+
+/***** Private Functions *****/
+size_t AllocTracker::Find(const char* name, bool expected) {
+    for (size_t i = 1; i < entryCount; ++i)
+        if (entries[i].name == name || std::strcmp(entries[i].name, name) == 0)
+            return i;
+
+    // The table is full: the allocations are counted without a scope
+    if (entryCount == maxScopes)
+        return 0;
+
+    entries[entryCount].name = name;
+    entries[entryCount].expected = expected;
+    return entryCount++;
+}
+/* ************************************************************************************ */
+
+#ifdef ALLOC_TRACK
+
+/***** Replaced global allocation functions *****/
+void* operator new(std::size_t size) {
+    AllocTracker::Record(size);
+    if (void* memory = std::malloc(size != 0 ? size : 1))
+        return memory;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    AllocTracker::Record(size);
+    if (void* memory = std::malloc(size != 0 ? size : 1))
+        return memory;
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    AllocTracker::Record(size);
+    return std::malloc(size != 0 ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    AllocTracker::Record(size);
+    return std::malloc(size != 0 ? size : 1);
+}
+
+void operator delete(void* memory) noexcept { std::free(memory); }
+void operator delete[](void* memory) noexcept { std::free(memory); }
+void operator delete(void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete[](void* memory, std::size_t) noexcept { std::free(memory); }
+void operator delete(void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+void operator delete[](void* memory, const std::nothrow_t&) noexcept { std::free(memory); }
+
+#endif // ALLOC_TRACK
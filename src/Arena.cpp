@@ -0,0 +1,78 @@
+/** @file Arena.cpp
+  * @brief Contains the implementation of Arena.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <cstddef>
+#include <new>
+
+#include "Arena.h"
+
+/**
+ * @brief The arena that is bound to the thread.
+ */
+static thread_local Arena* currentArena = nullptr;
+
+/**
+ * @brief Header in front of every object allocated by Arena::New (its size keeps the object aligned).
+ */
+union ObjectHeader {
+    Arena* arena;           ///< The arena of the object (nullptr if it is on the heap).
+    std::max_align_t align; ///< Only for the alignment.
+};
+
+Arena::Arena(size_t initialSize)
+    : buffer(new std::byte[initialSize > 0 ? initialSize : 1]), bufferSize(initialSize > 0 ? initialSize : 1),
+    resource(buffer.get(), bufferSize), used(0)
+    {
+}
+
+void* Arena::Allocate(size_t size, size_t alignment) {
+    used += size;
+    return resource.allocate(size, alignment);
+}
+
+void Arena::Release() {
+    resource.release();
+    used = 0;
+}
+
+std::pmr::memory_resource* Arena::Resource() { return &resource; }
+
+size_t Arena::GetUsed() const { return used; }
+
+void Arena::Bind(Arena* arena) { currentArena = arena; }
+
+void Arena::Unbind(Arena* arena) {
+    if (currentArena == arena)
+        currentArena = nullptr;
+}
+
+Arena* Arena::Current() { return currentArena; }
+
+void* Arena::New(size_t size) {
+    size_t total = sizeof(ObjectHeader) + size;
+    ObjectHeader* header = (ObjectHeader*) (currentArena != nullptr ? currentArena->Allocate(total) : ::operator new(total));
+    header->arena = currentArena;
+    return header + 1;
+}
+
+void Arena::Delete(void* memory) {
+    if (memory == nullptr)
+        return;
+    ObjectHeader* header = (ObjectHeader*) memory - 1;
+    if (header->arena == nullptr)
+        ::operator delete(header);
+}
+
+Arena::~Arena() {
+    Unbind(this);
+
+    #ifdef DTOR
+    std::clog << "~Arena Dtor" << std::endl;
+    #endif
+}
@@ -0,0 +1,173 @@
+/** @file AssetPack.cpp
+  * @brief Contains the implementation of AssetPack.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+#include <cstring>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "AssetPack.h"
+
+const std::uint32_t AssetPack::version = 1;
+const std::uint32_t AssetPack::alignment = 64;
+
+AssetPack::AssetPack() : data(nullptr), size(0), entries(nullptr), names(nullptr), count(0) {}
+
+bool AssetPack::Open(const std::string& path) {
+    Close();
+
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) < 0 || info.st_size < (off_t) sizeof(Header)) {
+        close(fd);
+        return false;
+    }
+
+    void* mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);  // The mapping stays valid
+    if (mapped == MAP_FAILED)
+        return false;
+
+    data = (const char*) mapped;
+    size = info.st_size;
+
+    if (!Validate()) {
+        std::cerr << "Invalid asset pack: " << path << std::endl;
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void AssetPack::Close() {
+    if (data != nullptr)
+        munmap((void*) data, size);
+    data = nullptr;
+    size = 0;
+    entries = nullptr;
+    names = nullptr;
+    count = 0;
+}
+
+bool AssetPack::IsOpen() const { return data != nullptr; }
+
+size_t AssetPack::Count() const { return count; }
+
+std::string_view AssetPack::Find(std::string_view name) const {
+    const Entry* end = entries + count;
+    const Entry* it = std::lower_bound(entries, end, name, [this](const Entry& entry, std::string_view name) {
+        return Name(entry) < name;
+    });
+
+    if (it == end || Name(*it) != name)
+        return {};
+    return { data + it->offset, (size_t) it->size };
+}
+
+size_t AssetPack::Build(const std::string& directory, const std::string& path) {
+    namespace fs = std::filesystem;
+
+    if (!fs::is_directory(directory))
+        throw std::runtime_error("Resource directory not found: " + directory);
+
+    std::vector<std::string> files;
+    for (auto& file : fs::recursive_directory_iterator(directory))
+        if (file.is_regular_file())
+            files.push_back(fs::relative(file.path(), directory).generic_string());
+    std::sort(files.begin(), files.end());
+
+    Header header = { {'C', 'M', 'P', 'K'}, version, (std::uint32_t) files.size(), 0 };
+    std::string nameTable;
+    for (auto& file : files)
+        nameTable += file;
+    header.namesSize = nameTable.size();
+
+    auto Align = [](std::uint64_t offset) { return (offset + alignment - 1) / alignment * alignment; };
+
+    std::vector<Entry> index;
+    index.reserve(files.size());
+    std::uint64_t offset = Align(sizeof(Header) + files.size() * sizeof(Entry) + nameTable.size());
+    std::uint32_t nameOffset = 0;
+    for (auto& file : files) {
+        std::uint64_t fileSize = fs::file_size(fs::path(directory) / file);
+        index.push_back({ offset, fileSize, nameOffset, (std::uint32_t) file.size() });
+        offset = Align(offset + fileSize);
+        nameOffset += file.size();
+    }
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+        throw std::runtime_error("Unable to create asset pack: " + path);
+
+    out.write((const char*) &header, sizeof(header));
+    out.write((const char*) index.data(), index.size() * sizeof(Entry));
+    out.write(nameTable.data(), nameTable.size());
+
+    for (size_t i = 0; i < files.size(); ++i) {
+        std::ifstream in(fs::path(directory) / files[i], std::ios::binary);
+        if (!in)
+            throw std::runtime_error("Unable to read asset: " + files[i]);
+
+        // Padding up to the aligned offset
+        std::string padding(index[i].offset - (std::uint64_t) out.tellp(), '\0');
+        out.write(padding.data(), padding.size());
+        out << in.rdbuf();
+    }
+
+    if (!out)
+        throw std::runtime_error("Failed to write asset pack: " + path);
+    return files.size();
+}
+
+AssetPack::~AssetPack() {
+    Close();
+    #ifdef DTOR
+    std::clog << "~AssetPack Dtor" << std::endl;
+    #endif
+}
+/* ************************************************************************************ */
+
+/***** Private Functions *****/
+std::string_view AssetPack::Name(const Entry& entry) const {
+    return { names + entry.nameOffset, entry.nameLength };
+}
+
+bool AssetPack::Validate() {
+    const Header* header = (const Header*) data;
+    if (std::memcmp(header->magic, "CMPK", 4) != 0 || header->version != version)
+        return false;
+
+    std::uint64_t indexEnd = sizeof(Header) + (std::uint64_t) header->count * sizeof(Entry);
+    if (indexEnd + header->namesSize > size)
+        return false;
+
+    entries = (const Entry*) (data + sizeof(Header));
+    names = data + indexEnd;
+    count = header->count;
+
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const Entry& entry = entries[i];
+        if ((std::uint64_t) entry.nameOffset + entry.nameLength > header->namesSize)
+            return false;
+        if (entry.offset > size || entry.size > size - entry.offset)
+            return false;
+    }
+    return true;
+}
@@ -0,0 +1,113 @@
+/** @file Assets.cpp
+  * @brief Contains the implementation of Assets.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef CPORTA
+
+#include <SDL2/SDL.h>
+
+#include <iostream>
+#include <fstream>
+#include <streambuf>
+#include <string>
+#include <memory>
+#include <iterator>
+#include <filesystem>
+
+#include "Assets.h"
+#include "AssetPack.h"
+
+AssetPack Assets::pack;
+std::string Assets::resourceDirectory = "../res/";
+std::string Assets::cacheDirectory = "cache/";
+std::string Assets::baseDirectory = "";
+
+/**
+ * @brief Input stream that reads directly from the mapped asset pack.
+ */
+class MemoryStream : public std::istream {
+private:
+    /**
+     * @brief Read-only stream buffer over a memory region.
+     */
+    struct MemoryBuffer : public std::streambuf {
+        MemoryBuffer(std::string_view data) {
+            char* begin = const_cast<char*>(data.data());
+            setg(begin, begin, begin + data.size());
+        }
+    } buffer;   ///< Buffer over the payload of the asset.
+
+public:
+    /**
+     * @param data Payload of the asset.
+     */
+    MemoryStream(std::string_view data) : std::istream(nullptr), buffer(data) { rdbuf(&buffer); }
+};
+
+void Assets::Init() {
+    std::string packPath = "res.pak";
+
+    char* basePath = SDL_GetBasePath();
+    if (basePath != nullptr) {
+        packPath = std::string(basePath) + packPath;
+        resourceDirectory = std::string(basePath) + "../res/";
+        cacheDirectory = std::string(basePath) + "cache/";
+        baseDirectory = basePath;
+        SDL_free(basePath);
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(cacheDirectory, error);
+
+    #ifndef HOT_RELOAD
+    if (pack.Open(packPath))
+        std::clog << "Loaded asset pack: " << pack.Count() << " assets" << std::endl;
+    #endif
+}
+
+std::string Assets::Path(const std::string& name) { return resourceDirectory + name; }
+
+std::string Assets::LocalPath(const std::string& name) { return baseDirectory + name; }
+
+std::string Assets::CachePath(const std::string& name, const std::string& extension) {
+    std::string fileName = name;
+    for (char& c : fileName)
+        if (c == '/')
+            c = '_';
+    return cacheDirectory + fileName + extension;
+}
+
+std::string_view Assets::Read(const std::string& name, std::string& buffer) {
+    std::string_view asset = pack.Find(name);
+    if (asset.data() != nullptr)
+        return asset;
+
+    std::ifstream file(Path(name), std::ios::binary);
+    if (!file)
+        return {};
+    buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return buffer;
+}
+
+SDL_RWops* Assets::Open(const std::string& name) {
+    std::string_view asset = pack.Find(name);
+    if (asset.data() != nullptr)
+        return SDL_RWFromConstMem(asset.data(), asset.size());
+
+    return SDL_RWFromFile(Path(name).c_str(), "rb");
+}
+
+std::unique_ptr<std::istream> Assets::OpenStream(const std::string& name) {
+    std::string_view asset = pack.Find(name);
+    if (asset.data() != nullptr)
+        return std::make_unique<MemoryStream>(asset);
+
+    auto file = std::make_unique<std::ifstream>(Path(name));
+    if (!file->is_open())
+        return nullptr;
+    return file;
+}
+
+#endif // CPORTA
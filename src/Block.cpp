@@ -10,6 +10,7 @@
 #include <SDL2/SDL_image.h>
 
 #include <iostream>
+#include <memory>
 #include <vector>
 #include <memory>
 
@@ -24,27 +25,27 @@ SDL_Texture* Block::textures = nullptr;
 
 /***** Class Block *****/
 Block::Block(SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect, bool removed)
-    : GameObject(hitBox, srcRect, destRect, Block::textures, removed) {
+    : GameObject(ObjectKind::BLOCK, hitBox, srcRect, destRect, Block::textures, removed) {
     //
 }
 
 void Block::Update(float dt) {}
 
 void Block::Render() {
-    if (!isRemoved)
-        texture.Render();
+    if (!GetFlags().isRemoved)
+        Sprite().Render();
     // HitBox:
-    // rectangleRGBA(window->GetRenderer(), hitBox.x, hitBox.y, hitBox.x + hitBox.w, hitBox.y + hitBox.h, 255, 0, 0, 255);
+    // rectangleRGBA(window->GetRenderer(), HitBox().x, HitBox().y, HitBox().x + HitBox().w, HitBox().y + HitBox().h, 255, 0, 0, 255);
     // Dest Rect:
     #ifdef COLLISION
-    rectangleRGBA(window->GetRenderer(), texture.DestRect().x, texture.DestRect().y, texture.DestRect().x + texture.DestRect().w, texture.DestRect().y + texture.DestRect().h, 0, 0, 255, 255);
+    rectangleRGBA(window->GetRenderer(), Sprite().DestRect().x, Sprite().DestRect().y, Sprite().DestRect().x + Sprite().DestRect().w, Sprite().DestRect().y + Sprite().DestRect().h, 0, 0, 255, 255);
     #endif
 }
 
 void Block::Reset() {
-    texture.DestRect().x = hitBox.x;
-    texture.DestRect().y = hitBox.y;
-    isRemoved = false;
+    Sprite().DestRect().x = HitBox().x;
+    Sprite().DestRect().y = HitBox().y;
+    GetFlags().isRemoved = false;
 }
 
 void Block::TouchedBy(Entity* entity) {
@@ -55,11 +56,9 @@ void Block::Limit(Entity* entity) {
     entity->LimitedBy(this);
 }
 
+std::unique_ptr<Block> Block::Clone() const { return std::make_unique<Block>(*this); }
+
 Block::~Block() {
-    if (Block::textures != nullptr) {
-        SDL_DestroyTexture(Block::textures);
-        Block::textures = nullptr;
-    }
     #ifdef DTOR
     std::clog << "~Block Dtor" << std::endl;
     #endif
@@ -68,25 +67,27 @@ Block::~Block() {
 
 /***** Class Hidden Block *****/
 HiddenBlock::HiddenBlock(SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect) : Block(hitBox, srcRect,
-    destRect, true), playAnimation(false) {
+    destRect, true) {
 }
 
 void HiddenBlock::Reset() {
-    texture.DestRect().x = hitBox.x;
-    texture.DestRect().y = hitBox.y;
-    isRemoved = true;
+    Sprite().DestRect().x = HitBox().x;
+    Sprite().DestRect().y = HitBox().y;
+    GetFlags().isRemoved = true;
 }
 
 void HiddenBlock::TouchedBy(Entity* entity) {
-    if (isRemoved && GameObject::OverhangUp(entity->HitBox(), hitBox) && entity->GetRigidBody().Velocity().y < 0) {
-        isRemoved = false;
+    if (GetFlags().isRemoved && GameObject::OverhangUp(entity->HitBox(), HitBox()) && entity->GetRigidBody().Velocity().y < 0) {
+        GetFlags().isRemoved = false;
         Limit(entity);
-        playAnimation = true;
+        GetFlags().playSound = true;
     }
-    else if (!isRemoved)
+    else if (!GetFlags().isRemoved)
         Limit(entity);
 }
 
+std::unique_ptr<Block> HiddenBlock::Clone() const { return std::make_unique<HiddenBlock>(*this); }
+
 HiddenBlock::~HiddenBlock() {
     #ifdef DTOR
     std::clog << "~HiddenBlock Dtor" << std::endl;
@@ -96,19 +97,21 @@ HiddenBlock::~HiddenBlock() {
 
 /***** Class Brick Block *****/
 BrickBlock::BrickBlock(SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect) : Block(hitBox, srcRect,
-    destRect, false), playAnimation(false) {
+    destRect, false) {
 }
 
 void BrickBlock::TouchedBy(Entity* entity) {
-    if (!isRemoved && GameObject::OverhangUp(entity->HitBox(), hitBox) && entity->GetRigidBody().Velocity().y < 0) {
-        isRemoved = true;
+    if (!GetFlags().isRemoved && GameObject::OverhangUp(entity->HitBox(), HitBox()) && entity->GetRigidBody().Velocity().y < 0) {
+        GetFlags().isRemoved = true;
         Limit(entity);
-        playAnimation = true;
+        GetFlags().playSound = true;
     }
-    else if (!isRemoved)
+    else if (!GetFlags().isRemoved)
         Limit(entity);
 }
 
+std::unique_ptr<Block> BrickBlock::Clone() const { return std::make_unique<BrickBlock>(*this); }
+
 BrickBlock::~BrickBlock() {
     #ifdef DTOR
     std::clog << "~BrickBlock Dtor" << std::endl;
@@ -118,35 +121,37 @@ BrickBlock::~BrickBlock() {
 
 /***** Class Mystery Block *****/
 MysteryBlock::MysteryBlock(SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect) : Block(hitBox, srcRect,
-    destRect, false), playAnimation(false) {
+    destRect, false) {
 }
 
 void MysteryBlock::Render() {
-    texture.Render();
+    Sprite().Render();
     // Dest Rect:
     #ifdef COLLISION
-    rectangleRGBA(window->GetRenderer(), texture.DestRect().x, texture.DestRect().y, texture.DestRect().x + texture.DestRect().w, texture.DestRect().y + texture.DestRect().h, 0, 0, 255, 255);
+    rectangleRGBA(window->GetRenderer(), Sprite().DestRect().x, Sprite().DestRect().y, Sprite().DestRect().x + Sprite().DestRect().w, Sprite().DestRect().y + Sprite().DestRect().h, 0, 0, 255, 255);
     #endif
 }
 
 void MysteryBlock::Reset() {
-    texture.DestRect().x = hitBox.x;
-    texture.DestRect().y = hitBox.y;
-    isRemoved = false;
-    texture.SrcRect().x = 150;
+    Sprite().DestRect().x = HitBox().x;
+    Sprite().DestRect().y = HitBox().y;
+    GetFlags().isRemoved = false;
+    Sprite().SrcRect().x = 150;
 }
 
 void MysteryBlock::TouchedBy(Entity* entity) {
-    if (!isRemoved && GameObject::OverhangUp(entity->HitBox(), hitBox) && entity->GetRigidBody().Velocity().y < 0) {
-        isRemoved = true;
+    if (!GetFlags().isRemoved && GameObject::OverhangUp(entity->HitBox(), HitBox()) && entity->GetRigidBody().Velocity().y < 0) {
+        GetFlags().isRemoved = true;
         Limit(entity);
-        playAnimation = true;
-        texture.SrcRect().x = 120;
+        GetFlags().playSound = true;
+        Sprite().SrcRect().x = 120;
     }
     else
         Limit(entity);
 }
 
+std::unique_ptr<Block> MysteryBlock::Clone() const { return std::make_unique<MysteryBlock>(*this); }
+
 MysteryBlock::~MysteryBlock() {
     #ifdef DTOR
     std::clog << "~MysteryBlock Dtor" << std::endl;
@@ -159,6 +164,24 @@ Grid::Grid(int blockSize) : width(0), height(0),
     blockSize(blockSize) {
 }
 
+Grid::Grid(const Grid& other) : width(0), height(0), blockSize(other.blockSize) {
+    *this = other;
+}
+
+Grid& Grid::operator=(const Grid& other) {
+    if (this == &other)
+        return *this;
+
+    width = other.width;
+    height = other.height;
+    blockSize = other.blockSize;
+    blocks.clear();
+    blocks.reserve(other.blocks.size());
+    for (auto& block : other.blocks)
+        blocks.push_back(block != nullptr ? block->Clone() : nullptr);
+    return *this;
+}
+
 void Grid::InitGrid(int width, int height) {
     this->width = width;
     this->height = height;
@@ -183,8 +206,8 @@ std::unique_ptr<Block>& Grid::operator[](int index) {
 int Grid::Size() const { return blocks.size(); }
 
 void Grid::Update(float dt) {
-    int startColumn = GameObject::screen.x / blockSize;
-    int endColumn = (GameObject::screen.x + GameObject::screen.w) / blockSize + 1;
+    int startColumn = GameObject::Screen().x / blockSize;
+    int endColumn = (GameObject::Screen().x + GameObject::Screen().w) / blockSize + 1;
     if (startColumn < 0) startColumn = 0;
     if (endColumn > width) endColumn = width;
 
@@ -195,8 +218,8 @@ void Grid::Update(float dt) {
 }
 
 void Grid::Render() {
-    int startColumn = GameObject::screen.x / blockSize;
-    int endColumn = (GameObject::screen.x + GameObject::screen.w) / blockSize + 1;
+    int startColumn = GameObject::Screen().x / blockSize;
+    int endColumn = (GameObject::Screen().x + GameObject::Screen().w) / blockSize + 1;
     if (startColumn < 0) startColumn = 0;
     if (endColumn > width) endColumn = width;
 
@@ -213,8 +236,8 @@ void Grid::Reset() {
 }
 
 void Grid::UpdateDestRect() {
-    int startColumn = GameObject::screen.x / blockSize - 1;
-    int endColumn = (GameObject::screen.x + GameObject::screen.w) / blockSize + 2;
+    int startColumn = GameObject::Screen().x / blockSize - 1;
+    int endColumn = (GameObject::Screen().x + GameObject::Screen().w) / blockSize + 2;
     if (startColumn < 0) startColumn = 0;
     if (endColumn > width) endColumn = width;
 
@@ -225,8 +248,8 @@ void Grid::UpdateDestRect() {
 }
 
 void Grid::CheckCollision(Entity* entity) {
-    int startColumn = GameObject::screen.x / blockSize;
-    int endColumn = (GameObject::screen.x + GameObject::screen.w) / blockSize + 1;
+    int startColumn = GameObject::Screen().x / blockSize;
+    int endColumn = (GameObject::Screen().x + GameObject::Screen().w) / blockSize + 1;
     if (startColumn < 0) startColumn = 0;
     if (endColumn > width) endColumn = width;
 
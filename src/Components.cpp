@@ -0,0 +1,76 @@
+/** @file Components.cpp
+  * @brief Contains the implementation of Components.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef CPORTA
+
+#include <SDL2/SDL.h>
+
+#include <iostream>
+#include <vector>
+
+#include "Components.h"
+#include "Texture.h"
+#include "RigidBody.h"
+
+Components::Components() : freeSlots(0) {
+    //
+}
+
+size_t Components::Create(ObjectKind::Kind kind, SDL_Rect hitBox, const Texture& sprite, bool isRemoved) {
+    Flags objectFlags = {(Uint8) kind, 0, isRemoved, false, false, false, false, false, false};
+
+    // Reusing a slot needs a search, but objects are rarely created while playing (they are recycled instead)
+    if (freeSlots > 0) {
+        for (size_t id = 0; id < flags.size(); ++id) {
+            if (flags[id].kind != ObjectKind::NONE)
+                continue;
+            --freeSlots;
+            transforms[id] = {hitBox, hitBox};
+            bodies[id] = RigidBody();
+            sprites[id] = sprite;
+            flags[id] = objectFlags;
+            return id;
+        }
+    }
+
+    transforms.push_back({hitBox, hitBox});
+    bodies.emplace_back();
+    sprites.push_back(sprite);
+    flags.push_back(objectFlags);
+    return flags.size() - 1;
+}
+
+void Components::Destroy(size_t id) {
+    flags[id].kind = ObjectKind::NONE;
+    ++freeSlots;
+}
+
+size_t Components::Size() const { return flags.size(); }
+
+void Components::UpdateDestRects(const std::vector<size_t>& ids, const SDL_Rect& screen) {
+    for (size_t id : ids) {
+        SDL_Rect& destRect = sprites[id].DestRect();
+        destRect.x = transforms[id].hitBox.x - screen.x;
+        destRect.y = transforms[id].hitBox.y - screen.y;
+
+        // Entities are drawn a pixel higher, so they do not sink into the ground
+        if (flags[id].kind == ObjectKind::PLAYER || flags[id].kind == ObjectKind::ENEMY)
+            destRect.y -= 1;
+    }
+}
+
+void Components::UpdatePreviousPositions(const std::vector<size_t>& ids) {
+    for (size_t id : ids)
+        transforms[id].previousPosition = transforms[id].hitBox;
+}
+
+Components::~Components() {
+    #ifdef DTOR
+    std::clog << "~Components Dtor" << std::endl;
+    #endif
+}
+
+#endif // CPORTA
@@ -11,25 +11,39 @@
 #include <SDL2/SDL2_gfxPrimitives.h>
 
 #include <iostream>
+#include <memory>
 
 #include "Entity.h"
 #include "RigidBody.h"
 #include "Texture.h"
+#include "World.h"
+#include "Components.h"
 
 SDL_Texture* Entity::textures = nullptr;
 
+const EnemyArchetype Enemy::archetypes[EnemyType::COUNT] = {
+    // name                 width height srcRect              shift spawnHeight
+    { "CommonEnemy",         75,   68,   {0, 68, 30, 27},     30,   75 },
+    { "SoldierEnemy",        75,   92,   {0, 95, 30, 38},     30,   100 },
+    { "KingEnemy",           80,   82,   {60, 68, 32, 33},    32,   75 },
+    { "RedMushroomEnemy",    73,   73,   {62, 131, 29, 29},   29,   75 },
+    { "PurpleMushroomEnemy", 73,   75,   {63, 101, 29, 30},   29,   75 }
+};
+
 /* ************************************************************************************ */
 
 /***** Class Entity *****/
-Entity::Entity(SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect, bool faceLeft)
-    : GameObject(hitBox, srcRect, destRect, textures), spawnPoint(hitBox),
-        previousPosition(spawnPoint), recoverX(false), recoverY(false), faceLeft(faceLeft), playSound(false)
+Entity::Entity(ObjectKind::Kind kind, SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect, bool faceLeft)
+    : GameObject(kind, hitBox, srcRect, destRect, textures), spawnPoint(hitBox), recoverX(false), recoverY(false)
     {
-    //
+    GetFlags().faceLeft = faceLeft;
 }
 
 void Entity::LimitedBy(GameObject* object) {
-    hasCollided = true;
+    SDL_Rect& hitBox = HitBox();
+    RigidBody& rigidBody = GetRigidBody();
+    Flags& flags = GetFlags();
+    flags.hasCollided = true;
     int right=0, left=0, up=0, down=0;
 
     // First: Fix Vertical Collision
@@ -38,7 +52,7 @@ void Entity::LimitedBy(GameObject* object) {
 
     if (up > 0 && down > 0) {
         recoverX = true; // !!!!!!!!!!!!!!!!!!!!!4
-        hasCollided = false;
+        flags.hasCollided = false;
     }
     else if (up > 0) {
         hitBox.y += up;
@@ -65,17 +79,17 @@ void Entity::LimitedBy(GameObject* object) {
         rigidBody.ApplyVelocityX(0.0f);
 
         if (dynamic_cast<Enemy*>(this))
-            faceLeft = true;
+            flags.faceLeft = true;
     }
     else if (left > 0) {
         hitBox.x += left;
         rigidBody.ApplyVelocityX(0.0f);
 
         if (dynamic_cast<Enemy*>(this))
-            faceLeft = false;
+            flags.faceLeft = false;
     }
 
-    if (hasCollided && (dynamic_cast<Enemy*>(this))) {
+    if (flags.hasCollided && (dynamic_cast<Enemy*>(this))) {
         rigidBody.ApplyForceY(0.0f);
     }
 
@@ -92,13 +106,13 @@ void Entity::LimitedBy(GameObject* object) {
     #endif
 }
 
-bool Entity::IsDead() const { return isRemoved; }
+bool Entity::IsDead() const { return components->GetFlags(id).isRemoved; }
 
-bool Entity::HasCollided() const { return hasCollided; }
+bool Entity::HasCollided() const { return components->GetFlags(id).hasCollided; }
 
-RigidBody& Entity::GetRigidBody() { return rigidBody; }
+SDL_Rect& Entity::PreviousPosition() { return components->GetTransform(id).previousPosition; }
 
-void Entity::UpdatePreviousPosition() { previousPosition = hitBox; }
+void Entity::UpdatePreviousPosition() { PreviousPosition() = HitBox(); }
 
 Entity::~Entity() {
     #ifdef DTOR
@@ -108,98 +122,103 @@ Entity::~Entity() {
 /* ************************************************************************************ */
 
 /***** Class Player *****/
-int Player::position = 0;
 
 Player::Player(SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect)
-    : Entity(hitBox, srcRect, destRect, false), deathCount(3), isGiga(false), isForcedByFlag(false),
-        onGround(false), jump(false), runSprite(false), runTime(0.0f)
+    : Entity(ObjectKind::PLAYER, hitBox, srcRect, destRect, false), deathCount(3), isGiga(false), isForcedByFlag(false),
+        onGround(false), airTime(0.0f), hasJumped(false), jump(false), jumpTime(World::Time), runSprite(false), runTime(0.0f)
     {
     //
 }
 
 void Player::Update(float dt) {
-    if (isForcedByFlag && !isRemoved) {
+    SDL_Rect& hitBox = HitBox();
+    RigidBody& rigidBody = GetRigidBody();
+    Flags& flags = GetFlags();
+
+    if (isForcedByFlag && !flags.isRemoved) {
         // Sliding down the End Flag
         if (hitBox.y + hitBox.h < bottomOfFlag) {
-            hitBox.y += 0.2f * dt;
+            rigidBody.Drift(Vector2D(0.0f, 0.2f), dt);
+            rigidBody.MoveY(hitBox.y);
             onGround = false;
-            rigidBody.Reset();
             // std::clog << "Sliding down the Flag!" << std::endl;
             return;
         }
         // Moves compulsively
         else {
             // std::clog << "Moves compulsively..." << std::endl;
-            hasCollided = false;
+            flags.hasCollided = false;
             rigidBody.Update(dt);
 
             rigidBody.ApplyForceX(0.0f);
             rigidBody.ApplyVelocityX(0.2f);
             
-            hitBox.x += (int) rigidBody.GetPosition().x;
-            hitBox.y += (int) rigidBody.GetPosition().y;
+            rigidBody.MoveX(hitBox.x);
+            rigidBody.MoveY(hitBox.y);
 
-            position = hitBox.x + hitBox.w;
+            World::Current().playerPosition = hitBox.x + hitBox.w;
         }
         return;
     }
 
     onGround = false;
-    hasCollided = false;
+    flags.hasCollided = false;
     rigidBody.Update(dt);
-    hitBox.x += (int) rigidBody.GetPosition().x;
+    rigidBody.MoveX(hitBox.x);
     
-    if (hitBox.x - GameObject::screen.x < 5) {
-        hitBox.x = GameObject::screen.x + 5;
+    if (hitBox.x - GameObject::Screen().x < 5) {
+        hitBox.x = GameObject::Screen().x + 5;
         rigidBody.ApplyVelocityX(0.0f);
     }
         
-    hitBox.y += (int) rigidBody.GetPosition().y;
+    rigidBody.MoveY(hitBox.y);
 
-    position = hitBox.x + hitBox.w;
+    World::Current().playerPosition = hitBox.x + hitBox.w;
 }
 
 void Player::Render() {
     #ifdef COLLISION
-    rectangleRGBA(window->GetRenderer(), texture.DestRect().x, texture.DestRect().y, texture.DestRect().x + texture.DestRect().w, texture.DestRect().y + texture.DestRect().h, 255, 0, 0, 255);
+    rectangleRGBA(window->GetRenderer(), Sprite().DestRect().x, Sprite().DestRect().y, Sprite().DestRect().x + Sprite().DestRect().w, Sprite().DestRect().y + Sprite().DestRect().h, 255, 0, 0, 255);
     #endif
 
     if (isGiga) {
-        texture.Render();
+        Sprite().Render();
         return;
     }
 
     // Choosing correct Sprite
-    if (faceLeft)
-        texture.SrcRect().y = 34;
+    if (GetFlags().faceLeft)
+        Sprite().SrcRect().y = 34;
     else
-        texture.SrcRect().y = 0;
+        Sprite().SrcRect().y = 0;
     
-    if (isRemoved)
-        texture.SrcRect().x = 72;
+    if (GetFlags().isRemoved)
+        Sprite().SrcRect().x = 72;
     else if (!onGround)
-        texture.SrcRect().x = 48;
+        Sprite().SrcRect().x = 48;
     else if (runSprite)
-        texture.SrcRect().x = 24;
+        Sprite().SrcRect().x = 24;
     else
-        texture.SrcRect().x = 0;
+        Sprite().SrcRect().x = 0;
         
-    texture.Render();
+    Sprite().Render();
 }
 
 void Player::Reset() {
-    rigidBody.Reset();
-    hitBox = spawnPoint;
-    previousPosition = spawnPoint;
-    texture.DestRect() = spawnPoint;
-    faceLeft = false;
-    isRemoved = false;
+    GetRigidBody().Reset();
+    HitBox() = spawnPoint;
+    PreviousPosition() = spawnPoint;
+    Sprite().DestRect() = spawnPoint;
+    GetFlags().faceLeft = false;
+    GetFlags().isRemoved = false;
     isForcedByFlag = false;
     isGiga = false;
-    playSound = false;
+    GetFlags().playSound = false;
     recoverX = false;
     recoverY = false;
-    texture.SrcRect() = {0, 0, 24, 34};
+    airTime = 0.0f;
+    hasJumped = false;
+    Sprite().SrcRect() = {0, 0, 24, 34};
 }
 
 void Player::Touch(GameObject* object) {
@@ -211,32 +230,32 @@ void Player::TouchedBy(Entity* entity) {
 }
 
 void Player::Kill() {
-    if (isRemoved)
+    if (GetFlags().isRemoved)
         return;
 
-    isRemoved = true;
+    GetFlags().isRemoved = true;
     --deathCount;
 
-    rigidBody.Reset();
-    rigidBody.ApplyVelocityY(-100.0f);
+    GetRigidBody().Reset();
+    GetRigidBody().ApplyVelocityY(-100.0f);
 }
 
 void Player::MakeGiga() {
     isGiga = true;
-    playSound = true;
-    if (faceLeft)
-        texture.SrcRect() = {96, 0, 41, 68};
+    GetFlags().playSound = true;
+    if (GetFlags().faceLeft)
+        Sprite().SrcRect() = {96, 0, 41, 68};
     else
-        texture.SrcRect() = {137, 0, 41, 68};
+        Sprite().SrcRect() = {137, 0, 41, 68};
     
-    texture.DestRect().w = 103;
-    texture.DestRect().h = 170;
+    Sprite().DestRect().w = 103;
+    Sprite().DestRect().h = 170;
 }
 
 void Player::SetBottomOfFlag(int y) {
     isForcedByFlag = true;
     bottomOfFlag = y;
-    faceLeft = false;
+    GetFlags().faceLeft = false;
 }
 
 bool Player::IsForcedByFlag() const { return isForcedByFlag; }
@@ -245,7 +264,7 @@ bool& Player::OnGround() { return onGround; }
 
 SDL_Rect& Player::SpawnPoint() { return spawnPoint; }
 
-int Player::GetPosition() { return position; }
+int Player::GetPosition() { return World::Current().playerPosition; }
 
 Player::~Player() {
     #ifdef DTOR
@@ -255,75 +274,140 @@ Player::~Player() {
 /* ************************************************************************************ */
 
 /***** Class Enemy *****/
-Enemy::Enemy(SDL_Rect hitBox, int activationPoint, SDL_Rect srcRect, int shiftTextureRight, SDL_Rect destRect, bool faceLeft)
-    : Entity(hitBox, srcRect, destRect, faceLeft), faceLeftDefault(faceLeft), isActivated(false),
+Enemy::Enemy(EnemyType::Type type, SDL_Rect hitBox, int activationPoint, SDL_Rect srcRect, int shiftTextureRight, SDL_Rect destRect, bool faceLeft)
+    : Entity(ObjectKind::ENEMY, hitBox, srcRect, destRect, faceLeft), faceLeftDefault(faceLeft),
         activationPoint(activationPoint), shiftTextureRight(shiftTextureRight)
     {
-    //
+    GetFlags().type = (Uint8) type;
 }
 
-void Enemy::Update(float dt) {
-    if ((activationPoint > Player::GetPosition() && !isActivated) || isRemoved)
-        return;
-
-    isActivated = true;
-    hasCollided = false;
-    rigidBody.Update(dt);
-    
-    hitBox.x += (int) rigidBody.GetPosition().x;
-    hitBox.y += (int) rigidBody.GetPosition().y;
-
-    if (faceLeft)
-        rigidBody.ApplyVelocityX(-0.1f);
-    else
-        rigidBody.ApplyVelocityX(0.1f);
-}
+void Enemy::Update(float dt) { Move(*components, id, dt); }
 
 void Enemy::Render() {
     // Dest Rect:
     #ifdef COLLISION
-    rectangleRGBA(window->GetRenderer(), texture.DestRect().x, texture.DestRect().y, texture.DestRect().x + texture.DestRect().w, texture.DestRect().y + texture.DestRect().h, 255, 0, 0, 255);
+    rectangleRGBA(window->GetRenderer(), Sprite().DestRect().x, Sprite().DestRect().y, Sprite().DestRect().x + Sprite().DestRect().w, Sprite().DestRect().y + Sprite().DestRect().h, 255, 0, 0, 255);
     #endif
 
-    if (isActivated == false || isRemoved)
+    if (GetFlags().isActivated == false || GetFlags().isRemoved)
         return;
 
-    SDL_Rect tempSrcRect = texture.SrcRect();
-    if (faceLeft == false)
+    SDL_Rect tempSrcRect = Sprite().SrcRect();
+    if (GetFlags().faceLeft == false)
         tempSrcRect.x += shiftTextureRight;
 
-    SDL_RenderCopy(Texture::renderer, texture.GetTexture(), &tempSrcRect, &texture.DestRect());
+    SDL_RenderCopy(Texture::renderer, Sprite().GetTexture(), &tempSrcRect, &Sprite().DestRect());
 }
 
 void Enemy::Reset() {
-    rigidBody.Reset();
-    hitBox = spawnPoint;
-    previousPosition = spawnPoint;
-    texture.DestRect() = spawnPoint;
-    isRemoved = false;
+    GetRigidBody().Reset();
+    HitBox() = spawnPoint;
+    PreviousPosition() = spawnPoint;
+    Sprite().DestRect() = spawnPoint;
+    GetFlags().isRemoved = false;
     recoverX = false;
     recoverY = false;
-    isActivated = false;
-    playSound = false;
-    faceLeft = faceLeftDefault;
+    GetFlags().isActivated = false;
+    GetFlags().playSound = false;
+    GetFlags().faceLeft = faceLeftDefault;
+}
+
+void Enemy::Respawn(int x, int y, int activationPoint, bool faceLeft) {
+    spawnPoint.x = x;
+    spawnPoint.y = y;
+    this->activationPoint = activationPoint;
+    faceLeftDefault = faceLeft;
+    Reset();
 }
 
+int Enemy::GetActivationPoint() const { return activationPoint; }
+
+void Enemy::Activate() { GetFlags().isActivated = true; }
+
 void Enemy::Touch(GameObject* object) {
     object->TouchedBy(this);
 }
 
-void Enemy::Kill() { isRemoved = true; }
+void Enemy::Kill() { GetFlags().isRemoved = true; }
+
+std::unique_ptr<Enemy> Enemy::Create(EnemyType::Type type, int x, int y, int activationPoint, bool faceLeft) {
+    const EnemyArchetype& archetype = archetypes[type];
+    SDL_Rect hitBox = {x, y, archetype.width, archetype.height};
+
+    switch (type) {
+        case EnemyType::COMMON:
+            return std::make_unique<CommonEnemy>(hitBox, activationPoint, archetype.srcRect, archetype.shiftTextureRight, hitBox, faceLeft);
+        case EnemyType::SOLDIER:
+            return std::make_unique<SoldierEnemy>(hitBox, activationPoint, archetype.srcRect, archetype.shiftTextureRight, hitBox, faceLeft);
+        case EnemyType::KING:
+            return std::make_unique<KingEnemy>(hitBox, activationPoint, archetype.srcRect, archetype.shiftTextureRight, hitBox, faceLeft);
+        case EnemyType::RED_MUSHROOM:
+            return std::make_unique<RedMushroomEnemy>(hitBox, activationPoint, archetype.srcRect, archetype.shiftTextureRight, hitBox, faceLeft);
+        case EnemyType::PURPLE_MUSHROOM:
+            return std::make_unique<PurpleMushroomEnemy>(hitBox, activationPoint, archetype.srcRect, archetype.shiftTextureRight, hitBox, faceLeft);
+        default:
+            throw "Unknown enemy type!";
+    }
+}
+
+EnemyType::Type Enemy::GetType() const { return (EnemyType::Type) components->GetFlags(id).type; }
+
+EnemyType::Type Enemy::FindType(std::string_view name) {
+    for (int type = 0; type < EnemyType::COUNT; ++type)
+        if (name == archetypes[type].name)
+            return (EnemyType::Type) type;
+    return EnemyType::COUNT;
+}
+
+void Enemy::UpdateAll(Components& components, const std::vector<size_t>& ids, float dt) {
+    for (size_t id : ids)
+        Move(components, id, dt);
+}
 
 Enemy::~Enemy() {
     #ifdef DTOR
     std::clog << "~Enemy Dtor" << std::endl;
     #endif
 }
+
+/***** Private Functions *****/
+void Enemy::Move(Components& components, size_t id, float dt) {
+    Flags& flags = components.GetFlags(id);
+    if (flags.isActivated == false || flags.isRemoved)
+        return;
+
+    SDL_Rect& hitBox = components.GetTransform(id).hitBox;
+    RigidBody& rigidBody = components.GetRigidBody(id);
+    flags.hasCollided = false;
+    rigidBody.Update(dt);
+
+    rigidBody.MoveX(hitBox.x);
+    rigidBody.MoveY(hitBox.y);
+
+    if (flags.faceLeft)
+        rigidBody.ApplyVelocityX(-0.1f);
+    else
+        rigidBody.ApplyVelocityX(0.1f);
+
+    // Logic of the types
+    switch (flags.type) {
+        case EnemyType::SOLDIER:
+            if (flags.isSqueezed) {
+                if (flags.isSliding)
+                    rigidBody.ApplyVelocityX(flags.faceLeft ? -0.5f : 0.5f);
+                else
+                    rigidBody.ApplyVelocityX(0.0f);
+            }
+            break;
+        default:
+            break;
+    }
+}
 /* ************************************************************************************ */
 
 /***** Class Common Enemy *****/
 CommonEnemy::CommonEnemy(SDL_Rect hitBox, int activationPoint, SDL_Rect srcRect, int shiftTextureRight, SDL_Rect destRect, bool faceLeft)
-    : Enemy(hitBox, activationPoint, srcRect, shiftTextureRight, destRect, faceLeft) {
+    : Enemy(EnemyType::COMMON, hitBox, activationPoint, srcRect, shiftTextureRight, destRect, faceLeft) {
     //
 }
 
@@ -333,7 +417,7 @@ void CommonEnemy::TouchedBy(Entity* entity) {
     else if (Player* player = dynamic_cast<Player*>(entity)) {
         if (GameObject::JumpedOnHead(player->HitBox(), this->HitBox()) && player->IsDead() == false) {
             this->Kill();
-            playSound = true;
+            GetFlags().playSound = true;
             player->GetRigidBody().ApplyVelocityY(-1.0f);
         }
         else
@@ -344,6 +428,8 @@ void CommonEnemy::TouchedBy(Entity* entity) {
         throw "Unknown entity!";
 }
 
+std::unique_ptr<Enemy> CommonEnemy::Clone() const { return std::make_unique<CommonEnemy>(*this); }
+
 CommonEnemy::~CommonEnemy() {
     #ifdef DTOR
     std::clog << "~CommonEnemy Dtor" << std::endl;
@@ -353,39 +439,25 @@ CommonEnemy::~CommonEnemy() {
 
 /***** Class Soldier Enemy *****/
 SoldierEnemy::SoldierEnemy(SDL_Rect hitBox, int activationPoint, SDL_Rect srcRect, int shiftTextureRight, SDL_Rect destRect, bool faceLeft)
-    : Enemy(hitBox, activationPoint, srcRect, shiftTextureRight, destRect, faceLeft), isSqueezed(false), isSliding(false) {
+    : Enemy(EnemyType::SOLDIER, hitBox, activationPoint, srcRect, shiftTextureRight, destRect, faceLeft) {
     //
 }
 
-void SoldierEnemy::Update(float dt) {
-    Enemy::Update(dt);
-    if (isActivated && !isRemoved && isSqueezed) {
-        if (isSliding) {
-            if (faceLeft)
-                rigidBody.ApplyVelocityX(-0.5f);
-            else
-                rigidBody.ApplyVelocityX(0.5f);
-        }
-        else
-            rigidBody.ApplyVelocityX(0.0f);
-    }
-}
-
 void SoldierEnemy::Reset() {
     Enemy::Reset();
-    isSqueezed = false;
-    isSliding = false;
-    texture.SrcRect() = {0, 95, 30, 38};
+    GetFlags().isSqueezed = false;
+    GetFlags().isSliding = false;
+    Sprite().SrcRect() = archetypes[EnemyType::SOLDIER].srcRect;
 }
 
 void SoldierEnemy::TouchedBy(Entity* entity) {
     if (dynamic_cast<Enemy*>(entity)) {
-        if (this->isSliding == false)
+        if (this->GetFlags().isSliding == false)
             return;
 
         // Checking if both are sliding Soldiers
         if (SoldierEnemy* otherSoldier = dynamic_cast<SoldierEnemy*>(entity))
-            if (otherSoldier->isSliding)
+            if (otherSoldier->GetFlags().isSliding)
                 this->Kill();
         
         entity->Kill();
@@ -394,35 +466,35 @@ void SoldierEnemy::TouchedBy(Entity* entity) {
         if (player->IsDead())
             return;
         // Squeeze Down
-        if (this->isSqueezed == false) {
-            if (GameObject::JumpedOnHead(player->HitBox(), this->hitBox)) {
-                this->isSqueezed = true;
-                this->playSound = true;
-                this->texture.SrcRect() = {0, 133, 30, 26};
-                this->texture.DestRect().w = 75;
-                this->texture.DestRect().h = 65;
-                this->hitBox.w = 75;
-                this->hitBox.h = 65;
+        if (this->GetFlags().isSqueezed == false) {
+            if (GameObject::JumpedOnHead(player->HitBox(), this->HitBox())) {
+                this->GetFlags().isSqueezed = true;
+                this->GetFlags().playSound = true;
+                this->Sprite().SrcRect() = {0, 133, 30, 26};
+                this->Sprite().DestRect().w = 75;
+                this->Sprite().DestRect().h = 65;
+                this->HitBox().w = 75;
+                this->HitBox().h = 65;
                 player->GetRigidBody().ApplyVelocityY(-10.0f);
             }
             else
                 player->Kill();
         }
         // Start Sliding
-        else if (this->isSqueezed && this->isSliding == false) {
-            if (GameObject::JumpedOnHead(player->HitBox(), this->hitBox)) {
-                this->isSliding = true;
-                this->playSound = true;
+        else if (this->GetFlags().isSqueezed && this->GetFlags().isSliding == false) {
+            if (GameObject::JumpedOnHead(player->HitBox(), this->HitBox())) {
+                this->GetFlags().isSliding = true;
+                this->GetFlags().playSound = true;
                 player->GetRigidBody().ApplyVelocityY(-10.0f);
             }
             else
                 player->Kill();
         }
         // Stop Sliding
-        else if (this->isSqueezed && this->isSliding) {
-            if (GameObject::JumpedOnHead(player->HitBox(), this->hitBox)) {
-                this->isSliding = false;
-                this->playSound = true;
+        else if (this->GetFlags().isSqueezed && this->GetFlags().isSliding) {
+            if (GameObject::JumpedOnHead(player->HitBox(), this->HitBox())) {
+                this->GetFlags().isSliding = false;
+                this->GetFlags().playSound = true;
                 player->GetRigidBody().ApplyVelocityY(-10.0f);   
             }
             else
@@ -435,7 +507,9 @@ void SoldierEnemy::TouchedBy(Entity* entity) {
         throw "Unknown entity!";
 }
 
-bool SoldierEnemy::IsSqueezed() const { return isSqueezed; }
+bool SoldierEnemy::IsSqueezed() const { return components->GetFlags(id).isSqueezed; }
+
+std::unique_ptr<Enemy> SoldierEnemy::Clone() const { return std::make_unique<SoldierEnemy>(*this); }
 
 SoldierEnemy::~SoldierEnemy() {
     #ifdef DTOR
@@ -446,7 +520,7 @@ SoldierEnemy::~SoldierEnemy() {
 
 /***** Class King Enemy *****/
 KingEnemy::KingEnemy(SDL_Rect hitBox, int activationPoint, SDL_Rect srcRect, int shiftTextureRight, SDL_Rect destRect, bool faceLeft)
-    : Enemy(hitBox, activationPoint, srcRect, shiftTextureRight, destRect, faceLeft) {
+    : Enemy(EnemyType::KING, hitBox, activationPoint, srcRect, shiftTextureRight, destRect, faceLeft) {
     //
 }
 
@@ -461,6 +535,8 @@ void KingEnemy::TouchedBy(Entity* entity) {
         throw "Unknown entity!";
 }
 
+std::unique_ptr<Enemy> KingEnemy::Clone() const { return std::make_unique<KingEnemy>(*this); }
+
 KingEnemy::~KingEnemy() {
     #ifdef DTOR
     std::clog << "~KingEnemy Dtor" << std::endl;
@@ -470,7 +546,7 @@ KingEnemy::~KingEnemy() {
 
 /***** Class Red Mushroom Enemy *****/
 RedMushroomEnemy::RedMushroomEnemy(SDL_Rect hitBox, int activationPoint, SDL_Rect srcRect, int shiftTextureRight, SDL_Rect destRect, bool faceLeft)
-    : Enemy(hitBox, activationPoint, srcRect, shiftTextureRight, destRect, faceLeft) {
+    : Enemy(EnemyType::RED_MUSHROOM, hitBox, activationPoint, srcRect, shiftTextureRight, destRect, faceLeft) {
     //
 }
 
@@ -486,6 +562,8 @@ void RedMushroomEnemy::TouchedBy(Entity* entity) {
         throw "Unknown entity!";
 }
 
+std::unique_ptr<Enemy> RedMushroomEnemy::Clone() const { return std::make_unique<RedMushroomEnemy>(*this); }
+
 RedMushroomEnemy::~RedMushroomEnemy() {
     #ifdef DTOR
     std::clog << "~RedMushroomEnemy Dtor" << std::endl;
@@ -495,7 +573,7 @@ RedMushroomEnemy::~RedMushroomEnemy() {
 
 /***** Class Purple Mushroom Enemy *****/
 PurpleMushroomEnemy::PurpleMushroomEnemy(SDL_Rect hitBox, int activationPoint, SDL_Rect srcRect, int shiftTextureRight, SDL_Rect destRect, bool faceLeft)
-    : Enemy(hitBox, activationPoint, srcRect, shiftTextureRight, destRect, faceLeft) {
+    : Enemy(EnemyType::PURPLE_MUSHROOM, hitBox, activationPoint, srcRect, shiftTextureRight, destRect, faceLeft) {
     //
 }
 
@@ -510,6 +588,8 @@ void PurpleMushroomEnemy::TouchedBy(Entity* entity) {
         throw "Unknown entity!";
 }
 
+std::unique_ptr<Enemy> PurpleMushroomEnemy::Clone() const { return std::make_unique<PurpleMushroomEnemy>(*this); }
+
 PurpleMushroomEnemy::~PurpleMushroomEnemy() {
     #ifdef DTOR
     std::clog << "~PurpleMushroomEnemy Dtor" << std::endl;
@@ -0,0 +1,65 @@
+/** @file Fixed.cpp
+  * @brief Contains the implementation of Fixed.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#include "Fixed.h"
+
+#include <iostream>
+#include <cstdint>
+#include <cmath>
+
+const int Fixed::fractionBits = 16;
+const int64_t Fixed::one = int64_t(1) << 16;
+
+Fixed::Fixed(int value) : raw(int64_t(value) * one) {}
+
+Fixed Fixed::FromFloat(float value) {
+    // Multiplying by a power of two is exact, so only the rounding is performed
+    return FromRaw(std::llround(value * (float) one));
+}
+
+Fixed Fixed::FromRaw(int64_t raw) {
+    Fixed value;
+    value.raw = raw;
+    return value;
+}
+
+int64_t Fixed::Raw() const { return raw; }
+
+float Fixed::ToFloat() const { return (float) raw / (float) one; }
+
+int Fixed::Floor() const { return (int) (raw >> fractionBits); }
+
+bool Fixed::operator==(const Fixed& rhs) const { return raw == rhs.raw; }
+
+bool Fixed::operator!=(const Fixed& rhs) const { return raw != rhs.raw; }
+
+bool Fixed::operator<(const Fixed& rhs) const { return raw < rhs.raw; }
+
+bool Fixed::operator>(const Fixed& rhs) const { return raw > rhs.raw; }
+
+Fixed Fixed::operator-() const { return FromRaw(-raw); }
+
+Fixed Fixed::operator+(const Fixed& rhs) const { return FromRaw(raw + rhs.raw); }
+
+Fixed Fixed::operator-(const Fixed& rhs) const { return FromRaw(raw - rhs.raw); }
+
+Fixed Fixed::operator*(const Fixed& rhs) const { return FromRaw((raw * rhs.raw) >> fractionBits); }
+
+Fixed Fixed::operator/(const Fixed& rhs) const { return FromRaw(raw * one / rhs.raw); }
+
+Fixed& Fixed::operator+=(const Fixed& rhs) {
+    raw += rhs.raw;
+    return *this;
+}
+
+Fixed& Fixed::operator-=(const Fixed& rhs) {
+    raw -= rhs.raw;
+    return *this;
+}
+
+std::ostream& operator<<(std::ostream& os, const Fixed& value) {
+    return os << value.ToFloat();
+}
@@ -0,0 +1,131 @@
+/** @file FramePacer.cpp
+  * @brief Contains the implementation of FramePacer.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "FramePacer.h"
+
+/**
+ * @param ms Duration in milliseconds.
+ * @return Returns the duration on the clock of the pacer.
+ */
+static FramePacer::Clock::duration FromMilliseconds(double ms) {
+    return std::chrono::duration_cast<FramePacer::Clock::duration>(std::chrono::duration<double, std::milli>(ms));
+}
+
+/**
+ * @param duration Duration on the clock of the pacer.
+ * @return Returns the duration in milliseconds.
+ */
+static double ToMilliseconds(FramePacer::Clock::duration duration) { return std::chrono::duration<double, std::milli>(duration).count(); }
+
+/***** Class FramePacer *****/
+const std::vector<double> FramePacer::bucketLimits = { 0.1, 0.25, 0.5, 1.0, 2.0, 4.0 };
+
+FramePacer::FramePacer(double periodMs, bool isVsync, double spinMarginMs)
+    : period(FromMilliseconds(periodMs)), spinMargin(FromMilliseconds(spinMarginMs)), isVsync(isVsync), isStarted(false),
+    histogram(bucketLimits.size() + 1, 0), missedFrames(0), maxError(0.0) {}
+
+void FramePacer::SetPeriod(double periodMs, bool isVsync) {
+    period = FromMilliseconds(periodMs);
+    this->isVsync = isVsync;
+    isStarted = false;
+}
+
+bool FramePacer::Wait(bool isPresented) {
+    Clock::time_point now = Clock::now();
+    if (isStarted == false) {
+        Restart();
+        return false;
+    }
+
+    // Presenting has waited for the display (if it has returned much earlier, vsync is not working, so the frame is paced)
+    if (isVsync && isPresented && now - lastFrame >= period / 2) {
+        Record(std::abs(ToMilliseconds(now - lastFrame - period)));
+        deadline = lastFrame = now;
+        return false;
+    }
+
+    deadline += period;
+    if (now > deadline + period) {
+        // More than a frame late (e.g. a level has been loaded): it is not caught up, the schedule starts again
+        Record(ToMilliseconds(now - deadline));
+        ++missedFrames;
+        deadline = lastFrame = now;
+        return false;
+    }
+    WaitUntil(deadline);
+    lastFrame = Clock::now();
+    Record(ToMilliseconds(lastFrame - deadline));
+    return true;
+}
+
+void FramePacer::Restart() {
+    deadline = lastFrame = Clock::now();
+    isStarted = true;
+}
+
+void FramePacer::Record(double errorMs) {
+    errorMs = std::abs(errorMs);
+    size_t bucket = std::upper_bound(bucketLimits.begin(), bucketLimits.end(), errorMs) - bucketLimits.begin();
+    ++histogram[bucket];
+    maxError = std::max(maxError, errorMs);
+}
+
+const std::vector<std::uint64_t>& FramePacer::GetHistogram() const { return histogram; }
+
+std::uint64_t FramePacer::GetFrameCount() const {
+    std::uint64_t count = 0;
+    for (std::uint64_t frames : histogram)
+        count += frames;
+    return count;
+}
+
+std::uint64_t FramePacer::GetMissedFrames() const { return missedFrames; }
+
+double FramePacer::GetMaxError() const { return maxError; }
+
+void FramePacer::Report(std::ostream& os) const {
+    std::uint64_t count = GetFrameCount();
+    os << "***** Frame pacing error (ms) *****" << std::endl;
+    os << std::fixed << std::setprecision(2);
+    for (size_t i = 0; i < histogram.size(); ++i) {
+        if (i < bucketLimits.size())
+            os << "  < " << std::setw(5) << bucketLimits[i];
+        else
+            os << "  >=" << std::setw(5) << bucketLimits.back();
+        os << ": " << std::setw(8) << histogram[i] << " frames (" << std::setw(6)
+            << (count == 0 ? 0.0 : 100.0 * histogram[i] / count) << "%)" << std::endl;
+    }
+    os << count << " frames, " << missedFrames << " missed, max " << maxError << std::endl;
+    os << std::defaultfloat;
+}
+
+FramePacer::~FramePacer() {
+    #ifdef DTOR
+    std::clog << "~FramePacer Dtor" << std::endl;
+    #endif
+}
+/* ************************************************************************************ */
+
+/***** Private Functions *****/
+void FramePacer::WaitUntil(Clock::time_point time) const {
+    // The scheduler may wake the thread late, so the last part is spun
+    Clock::time_point now = Clock::now();
+    while (time - now > spinMargin) {
+        std::this_thread::sleep_for(time - now - spinMargin);
+        now = Clock::now();
+    }
+    while (Clock::now() < time);
+}
+/* ************************************************************************************ */
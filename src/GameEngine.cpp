@@ -16,9 +16,14 @@
 #include <iostream>
 #include <string>
 #include <vector>
+#include <deque>
+#include <functional>
+#include <memory_resource>
 #include <fstream>
 #include <sstream>
 #include <random>
+#include <algorithm>
+#include <cmath>
 #include <ctime>
 
 #include "GameEngine.h"
@@ -30,74 +35,160 @@
 #include "Entity.h"
 #include "Block.h"
 #include "LevelElement.h"
+#include "Components.h"
 #include "LanguageModule.h"
 #include "Timer.h"
 #include "Input.h"
 #include "Sound.h"
-#include "CoinAnimation.h"
-
-const int GameEngine::frameDelay = 1000 / FPS;
+#include "ParticleSystem.h"
+#include "LatencyProbe.h"
+#include "Arena.h"
+#include "AllocTracker.h"
+#include "ImageLoader.h"
+#include "StartupReport.h"
+#include "LevelRegistry.h"
+#include "FramePacer.h"
+
+int GameEngine::frameDelay = 10;
+float GameEngine::frameStep = 10.0f;
+const int GameEngine::maxUpdateCycles = 5;
 int GameEngine::frameTime = 0;
 RenderWindow* GameEngine::window = nullptr;
+const size_t GameEngine::maxQuoteLength = 512;
+const int GameEngine::idleTimeout = 100;
+const size_t GameEngine::levelColumns = 4;
+const size_t GameEngine::levelsPerPage = 8;
 /* ************************************************************************************ */
 /***** Constructor *****/
-GameEngine::GameEngine(RenderWindow& window) : currentLevel(Level::NONE), nextLevel(Level::NONE), completedLevels(Level::NONE),
-    exitProgram(false), isPaused(false),
+GameEngine::GameEngine(RenderWindow& window, const PerformanceConfig& config) : currentLevel(LevelRegistry::none), nextLevel(LevelRegistry::none), completedLevels(0), levelPage(0),
+    exitProgram(false), isPaused(false), isMinimized(false), isRedrawNeeded(true), pausedFrame(nullptr),
     currentScene(Scene::TITLE), nextScene(Scene::NONE), currentLanguage(ENGLISH),
     titleButton (new TextButton(Button::NONE, Lang::PRESS, 610, 810, WHITE, REG30, currentLanguage, 80)),
     deathButton (new TextButton(Button::NONE, " ", 820, 355, WHITE, MED50)),
-    titleScreen("../res/img/TitleScreen.png", {0, 0, 1600, 900}),
-    menuScreen("../res/img/MenuScreen.png", {0, 0, 1600, 900})
+    images(Texture::GetNativeFormat(), { "img/MenuScreen.png", "img/FlagENG.png", "img/FlagJP.png", "img/FlagHUN.png", "img/IconX.png",
+        "img/Block.png", "img/Entity.png", "img/LevelElement.png", "img/Coin.png" }, config.threads),
+    sounds(config.audioBuffer, config.voices),
+    titleScreen("img/TitleScreen.png", {0, 0, 1600, 900}),
+    menuScreen(nullptr, {0, 0, 1600, 900}, {0, 0, 1600, 900}),
+    input(JUMP_BUFFER), scratch(4 * 1024), isTitleShown(false), isStartupFinished(false), printStartupReport(false), printPacingReport(false),
+    isVsync(false), updateLag(0.0), lastUpdate(0)
     {
     GameEngine::window = &window;
+    // The update cycles always have the same step, locked to vsync only the frames follow the display
+    int refreshRate = config.vsync ? window.GetRefreshRate() : 0;
+    double period = 1000.0 / config.fps;
+    GameEngine::frameStep = (float) period;
+    GameEngine::frameDelay = std::max(1, (int) std::lround(period));
+    isVsync = refreshRate > 0;
+    pacer.SetPeriod(isVsync ? 1000.0 / refreshRate : period, isVsync);
+    Texture::loader = &images;
     
-    LangMod.push_back(new LanguageModule("../res/lang/English.txt"));
-    LangMod.push_back(new LanguageModule("../res/lang/Japanese.txt"));
-    LangMod.push_back(new LanguageModule("../res/lang/Hungarian.txt"));
-    
-    menuButtons.push_back((Button*) new TextButton(Button::START, Lang::START, 200, 330, BLACK, MED50, currentLanguage, 200, true));
-    menuButtons.push_back((Button*) new TextButton(Button::NONE, Lang::CAT_MARIO, 60, 80, BLACK, BOLD100, currentLanguage, 200));
-    menuButtons.push_back((Button*) new TextButton(Button::NONE, Lang::PAUSE, 920, 300, BLACK, REG30, currentLanguage, 200));
-    menuButtons.push_back((Button*) new TextButton(Button::LVL1, Lang::LVL1, 250, 470, BLACK, REG30, currentLanguage, 200, false));
-    menuButtons.push_back((Button*) new TextButton(Button::LVL2, Lang::LVL2, 400, 470, BLACK, REG30, currentLanguage, 200, false));
-
-    menuButtons.push_back((Button*) new ImageButton(Button::ENG, {920, 100, 200, 100}, "../res/img/FlagENG.png", true));
-    menuButtons.push_back((Button*) new ImageButton(Button::JP, {1170, 100, 150, 100}, "../res/img/FlagJP.png"));
-    menuButtons.push_back((Button*) new ImageButton(Button::HUN, {1370, 100, 150, 100}, "../res/img/FlagHUN.png"));
-    menuButtons.push_back((Button*) new ImageButton(Button::EXIT, {1540, 10, 50, 50}, "../res/img/IconX.png"));
-
-    
-    gameButtons.push_back((Button*) new TextButton(Button::CONTINUE, Lang::CONTINUE, 400, 400, BLACK, MED50, currentLanguage, 255));
-    gameButtons.push_back((Button*) new TextButton(Button::EXIT, Lang::EXIT_TO_MENU, 400, 550, BLACK, MED50, currentLanguage, 255));
-    
-    gameButtons.push_back((Button*) new ImageButton(Button::ENG, {690, 200, 200, 100}, "../res/img/FlagENG.png", true));
-    gameButtons.push_back((Button*) new ImageButton(Button::JP, {925, 200, 150, 100}, "../res/img/FlagJP.png"));
-    gameButtons.push_back((Button*) new ImageButton(Button::HUN, {1110, 200, 150, 100}, "../res/img/FlagHUN.png"));
-    gameButtons.push_back((Button*) new ImageButton(Button::CONTINUE, {1325, 175, 50, 50}, "../res/img/IconX.png"));
+    // Languages are loaded when they are first used
+    LangMod.resize(3);
 
     LoadSounds();
     PlaySound(Sound::LOBBY, true);
+
+    // Only the title screen is loaded before it is shown, the rest is loaded while it is shown
+    QueueStartupTasks();
 }
 /* ************************************************************************************ */
 
 /***** Public Functions *****/
 void GameEngine::ApplyEvenFPS() {
     frameTime = SDL_GetTicks() - frameStart;
-    
-    if (frameDelay > frameTime)
-        SDL_Delay(frameDelay - frameTime);
+    pacer.Wait(IsRedrawNeeded());
+}
+
+void GameEngine::LoadIncrementally() {
+    if (isStartupFinished)
+        return;
+    StartupReport& report = StartupReport::Instance();
+    if (isTitleShown == false) {
+        isTitleShown = true;
+        report.Mark("title screen shown");
+    }
+
+    // At least one piece per frame, then only while the frame has time left
+    if (startupTasks.empty() == false) {
+        do
+            RunStartupTask();
+        while (startupTasks.empty() == false && SDL_GetTicks() - frameStart < (Uint32) frameDelay / 2);
+    }
+
+    if (startupTasks.empty() && images.IsIdle() && sounds.IsLoading() == false) {
+        isStartupFinished = true;
+        int failedSounds = sounds.GetFailedCount();
+        if (failedSounds > 0)
+            std::cerr << failedSounds << " sound effect(s) failed to load, they are not played (see above)" << std::endl;
+        report.Finish();
+        if (printStartupReport)
+            report.Print(std::clog);
+    }
 }
 
+void GameEngine::SetStartupReport(bool enabled) { printStartupReport = enabled; }
+
+void GameEngine::SetPacingReport(bool enabled) { printPacingReport = enabled; }
+
 void GameEngine::HandleEvents() {
+    ALLOC_SCOPE("GameEngine::HandleEvents");
+    SDL_Event event;
+
+    // Nothing is animating: sleep until an event arrives (the timeout keeps the music changing, see Sound::Update)
+    bool isIdle = IsIdle();
+    bool hasEvent = isIdle && SDL_WaitEventTimeout(&event, idleTimeout) == 1;
+    if (isIdle)
+        pacer.Restart();
+
     frameStart = SDL_GetTicks();
+    scratch.Release();
     anyKeyPressed = false;
-    SDL_Event event;
+    sounds.Update();
+    isRedrawNeeded = isIdle == false || hasEvent;
 
-    while (SDL_PollEvent(&event))
+    if (hasEvent)
+        HandleEvent(event);
+    while (SDL_PollEvent(&event)) {
         HandleEvent(event);
+        isRedrawNeeded = true;
+    }
+
+    // A single update cycle follows: it consumes the moving keys pressed until now
+    input.Consume(frameStart);
+    #ifdef LATENCY
+    latency.Consume(frameStart);
+    #endif
+}
+
+bool GameEngine::IsRedrawNeeded() const { return isRedrawNeeded && isMinimized == false; }
+
+#ifdef LATENCY
+void GameEngine::FramePresented() { latency.Present(SDL_GetTicks(), ToString(currentScene)); }
+#endif
+
+#ifdef ALLOC_TRACK
+void GameEngine::SetAssertNoAlloc(bool enabled) { assertNoAlloc = enabled; }
+
+void GameEngine::CheckAllocations() {
+    // A newly loaded level still fills its containers in the first frames
+    const int warmUpFrames = 60;
+    bool isSteady = currentScene == Scene::GAME && nextScene == Scene::GAME && isPaused == false && transition.IsActive() == false;
+    steadyFrames = isSteady ? steadyFrames + 1 : 0;
+
+    AllocTracker::Counter frame = AllocTracker::GetFrame();
+    if (steadyFrames <= warmUpFrames || frame.allocations == 0)
+        return;
+
+    std::cerr << "Allocation in a steady-state frame of the game (" << frame.allocations << " allocations, " << frame.bytes << " bytes):" << std::endl;
+    AllocTracker::ReportFrame(std::cerr);
+    if (assertNoAlloc)
+        exit(1);
 }
+#endif
 
 void GameEngine::HandlePressedKeys() {
+    ALLOC_SCOPE("GameEngine::HandlePressedKeys");
     if (anyKeyPressed == false && currentScene != Scene::GAME)
         return;
     switch (currentScene) {
@@ -106,10 +197,8 @@ void GameEngine::HandlePressedKeys() {
     case Scene::MENU:
         if (input.GetEsc())
             ExitProgram();
-        else if (input.GetSpace()) {
-            nextLevel = Level::LVL1;
-            ChangeSceneFromMenuToGame();
-        }
+        else if (input.GetSpace())
+            StartLevel(0);
         break;
     case Scene::GAME:
         if (input.GetPause() && !isPaused && input.DisableP() == false) {
@@ -130,67 +219,7 @@ void GameEngine::HandlePressedKeys() {
                 input.DisableEsc() = true;
             }
         }
-        if (isPaused || nextScene == Scene::MENU || level->player->IsDead() || level->player->isForcedByFlag)
-            return;
-        // Vertically Still
-        if (input.GetUp() && input.GetDown()) {
-            // xxx
-        }
-        // Up
-        else if (input.GetUp() == true && level->player->jumpTime.IsActive() == false && level->player->onGround && level->player->jump == false) {
-            level->player->GetRigidBody().ApplyForceY(-5.5f * RigidBody::gravity);
-            level->player->jumpTime.Activate(100);
-            level->player->jump = true;
-            #ifdef COLLISION
-            std::clog << "Activate Jump Time!" << std::endl;
-            #endif
-            PlaySound(Sound::JUMP);
-        }
-        // Down
-        else if (input.GetDown() == true) {
-            // xxx
-        }
-        // Handle Jump
-        if (level->player->jumpTime.GetPercent() > 0.5f && level->player->jumpTime.IsActive()) {
-            // Long Jump
-            if (level->player->jump) {
-                level->player->GetRigidBody().ApplyForceY(-4.0f * RigidBody::gravity);
-                level->player->jumpTime.Activate(100);
-                level->player->jump = false;
-                #ifdef COLLISION
-                std::clog << "Long Jump!" << std::endl;
-                #endif
-            }
-            // Stop Jumping
-            else {
-                level->player->GetRigidBody().ApplyForceY(0.0f);
-                level->player->jumpTime.Deactivate();
-                #ifdef COLLISION
-                std::clog << "Deactivate Jump!" << std::endl;
-                #endif
-            }
-        }
-
-        // Horizontally Still
-        if ((input.GetRight() && input.GetLeft()) || (!input.GetRight() && !input.GetLeft())) {
-            level->player->GetRigidBody().ApplyForceX(0.0f);
-        }
-        // Right
-        else if (input.GetRight() == true) {
-            level->player->GetRigidBody().ApplyForceX(2.0f);
-            level->player->faceLeft = false;
-            level->player->runTime += (float) frameDelay / 1000.0f;
-        }
-        // Left
-        else if (input.GetLeft() == true) {
-            level->player->GetRigidBody().ApplyForceX(-2.0f);
-            level->player->faceLeft = true;
-            level->player->runTime += (float) frameDelay / 1000.0f;
-        }
-        if (level->player->runTime > 0.08f) {
-            level->player->runSprite = !level->player->runSprite;
-            level->player->runTime = 0.0f;
-        }
+        // The player is moved by the keys in every update cycle (see UpdateGame)
         break;
     case Scene::DEATH: throw "Scene not allowed!";
     default: throw "Scene not found!";
@@ -198,6 +227,7 @@ void GameEngine::HandlePressedKeys() {
 }
 
 void GameEngine::HandleSceneChanges() {
+    ALLOC_SCOPE("GameEngine::HandleSceneChanges");
     switch (currentScene) {
     case Scene::TITLE:
         switch (nextScene) {
@@ -240,7 +270,7 @@ void GameEngine::HandleSceneChanges() {
 void GameEngine::UpdateButtons() {
     // Title Screen Button
     if (titleButton != nullptr)
-        static_cast<TextButton*>(titleButton)->UpdateCaption(LangMod[ENGLISH]->GetTranslation(
+        static_cast<TextButton*>(titleButton)->UpdateCaption(GetLanguageModule(ENGLISH).GetTranslation(
             static_cast<TextButton*>(titleButton)->GetCaptionType()), ENGLISH);
     
     // Menu Buttons
@@ -251,17 +281,33 @@ void GameEngine::UpdateButtons() {
     for (Button* button : gameButtons)
         UpdateSingeButton(button);
 
-    // Quote Button
-    if (level != nullptr && level->enemyWithQuote != nullptr)
-        level->quote = LangMod[currentLanguage]->GetQuote(level->quote.quoteIndex);
+    // Level Buttons (their captions are not translated by their type)
+    UpdateLevelButtons();
+
+    // Quote Button (it is part of the paused frame too)
+    FreePausedFrame();
+    if (level != nullptr && level->enemyWithQuote != nullptr) {
+        level->quote = GetLanguageModule(currentLanguage).GetQuote(level->quote.quoteIndex);
+        if (level->quoteButton != nullptr)
+            level->quoteButton->UpdateCaption(level->quote.quote, currentLanguage);
+    }
 }
 
 void GameEngine::UpdateGame() {
+    ALLOC_SCOPE("GameEngine::UpdateGame");
     if (level == nullptr || currentScene != Scene::GAME)
         return;
     if (CheckIfLevelCompleted())
         return;
 
+    #ifdef HOT_RELOAD
+    if (levelWatcher.HasChanged()) {
+        level->Reload();
+        FreePausedFrame();
+        isRedrawNeeded = true;
+    }
+    #endif
+
     AssignQuote();
     if (isPaused)
         return;
@@ -269,20 +315,23 @@ void GameEngine::UpdateGame() {
     if (level->player->IsDead())
         ChangeSceneFromGameToDeathToGame();
 
-    level->Update((float)frameDelay);
-
-    CheckForDeath();
-
-    CheckForCollision();
+    for (int cycles = GetUpdateCycles(); cycles > 0; --cycles) {
+        if (nextScene != Scene::MENU && level->player->IsDead() == false && level->player->isForcedByFlag == false) {
+            level->HandleInput(GetPlayerInput(), frameStep);
+            HandleLevelEvents();
+        }
 
-    CheckForAnimation();
+        level->Simulate(GetPlayerInput(), frameStep);
 
-    RecoverPosition(); // if necessary
+        HandleLevelEvents();
+        level->UpdateParticles(frameStep);
 
-    UpdateRects();
+        UpdateRects();
+    }
 }
 
 void GameEngine::RenderItems() {
+    ALLOC_SCOPE("GameEngine::RenderItems");
     switch (currentScene) {
     case Scene::TITLE:
         if (transition.GetPercent() < 0.5f) {
@@ -310,10 +359,12 @@ void GameEngine::RenderItems() {
         switch (nextScene) {
         // Normal Game
         case Scene::GAME:
-            if (level != nullptr)
-                level->Render();
             if (isPaused)
-                RenderPause();
+                RenderPausedFrame();
+            else if (level != nullptr) {
+                FreePausedFrame();
+                level->Render();
+            }
             break;
         // Load & Death Scene
         case Scene::LOAD:
@@ -370,6 +421,9 @@ bool GameEngine::GetExitProgram() const { return exitProgram; }
 void GameEngine::RenderMenuButtons() {
     for (Button* button : menuButtons)
         button->DrawButton();
+    for (size_t slot = 0; slot < levelButtons.size(); ++slot)
+        if (IsLevelButtonShown(slot))
+            levelButtons[slot]->DrawButton();
 }
 
 void GameEngine::RenderGameButtons() {
@@ -382,6 +436,91 @@ void GameEngine::RenderPause() {
     RenderGameButtons();
 }
 
+void GameEngine::RenderPausedFrame() {
+    if (level == nullptr)
+        return;
+    SDL_Renderer* renderer = window->GetRenderer();
+
+    // The level does not change while paused, so it is only drawn once (the buttons are drawn every time)
+    if (pausedFrame == nullptr) {
+        pausedFrame = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, window->GetWidth(), window->GetHeight());
+        if (pausedFrame == nullptr) {
+            level->Render();
+            RenderPause();
+            return;
+        }
+        SDL_SetRenderTarget(renderer, pausedFrame);
+        SDL_RenderClear(renderer);
+        level->Render();
+        SDL_SetRenderTarget(renderer, nullptr);
+    }
+    SDL_RenderCopy(renderer, pausedFrame, nullptr, nullptr);
+    RenderPause();
+}
+
+void GameEngine::FreePausedFrame() {
+    if (pausedFrame != nullptr) {
+        SDL_DestroyTexture(pausedFrame);
+        pausedFrame = nullptr;
+    }
+}
+
+bool GameEngine::IsIdle() const {
+    if (transition.IsActive() || startupTasks.empty() == false)
+        return false;
+
+    switch (currentScene) {
+    case Scene::TITLE:
+    case Scene::MENU: return true;
+    case Scene::GAME: return isPaused && nextScene == Scene::GAME;
+    default: return false;
+    }
+}
+
+void GameEngine::QueueStartupTasks() {
+    // Every button is a separate piece, they are created in the same order as before
+    auto queueButton = [this](const char* name, std::vector<Button*>& buttons, std::function<Button*()> create) {
+        startupTasks.push_back({name, [this, &buttons, create]() {
+            buttons.push_back(create());
+            UpdateSingeButton(buttons.back());
+        }});
+    };
+
+    startupTasks.push_back({"menu screen", [this]() { menuScreen.LoadTexture("img/MenuScreen.png"); }});
+
+    queueButton("menu: start", menuButtons, [this]() { return (Button*) new TextButton(Button::START, Lang::START, 200, 330, BLACK, MED50, currentLanguage, 200, true); });
+    queueButton("menu: title", menuButtons, [this]() { return (Button*) new TextButton(Button::NONE, Lang::CAT_MARIO, 60, 80, BLACK, BOLD100, currentLanguage, 200); });
+    queueButton("menu: pause", menuButtons, [this]() { return (Button*) new TextButton(Button::NONE, Lang::PAUSE, 920, 300, BLACK, REG30, currentLanguage, 200); });
+    startupTasks.push_back({"level registry", [this]() { LoadLevelRegistry(); }});
+    startupTasks.push_back({"menu: levels", [this]() { CreateLevelButtons(); }});
+
+    queueButton("menu: english", menuButtons, []() { return (Button*) new ImageButton(Button::ENG, {920, 100, 200, 100}, "img/FlagENG.png", true); });
+    queueButton("menu: japanese", menuButtons, []() { return (Button*) new ImageButton(Button::JP, {1170, 100, 150, 100}, "img/FlagJP.png"); });
+    queueButton("menu: hungarian", menuButtons, []() { return (Button*) new ImageButton(Button::HUN, {1370, 100, 150, 100}, "img/FlagHUN.png"); });
+    queueButton("menu: exit", menuButtons, []() { return (Button*) new ImageButton(Button::EXIT, {1540, 10, 50, 50}, "img/IconX.png"); });
+
+    queueButton("game: continue", gameButtons, [this]() { return (Button*) new TextButton(Button::CONTINUE, Lang::CONTINUE, 400, 400, BLACK, MED50, currentLanguage, 255); });
+    queueButton("game: exit to menu", gameButtons, [this]() { return (Button*) new TextButton(Button::EXIT, Lang::EXIT_TO_MENU, 400, 550, BLACK, MED50, currentLanguage, 255); });
+
+    queueButton("game: english", gameButtons, []() { return (Button*) new ImageButton(Button::ENG, {690, 200, 200, 100}, "img/FlagENG.png", true); });
+    queueButton("game: japanese", gameButtons, []() { return (Button*) new ImageButton(Button::JP, {925, 200, 150, 100}, "img/FlagJP.png"); });
+    queueButton("game: hungarian", gameButtons, []() { return (Button*) new ImageButton(Button::HUN, {1110, 200, 150, 100}, "img/FlagHUN.png"); });
+    queueButton("game: continue (icon)", gameButtons, []() { return (Button*) new ImageButton(Button::CONTINUE, {1325, 175, 50, 50}, "img/IconX.png"); });
+}
+
+void GameEngine::RunStartupTask() {
+    StartupTask task = std::move(startupTasks.front());
+    startupTasks.pop_front();
+
+    StartupReport::Scope scope(task.name);
+    task.run();
+}
+
+void GameEngine::FinishStartupTasks() {
+    while (startupTasks.empty() == false)
+        RunStartupTask();
+}
+
 void GameEngine::ChangeSceneFromTitleToMenu() {
     // Already started changes
     if (nextScene == Scene::MENU) {
@@ -395,7 +534,8 @@ void GameEngine::ChangeSceneFromTitleToMenu() {
         return;
     }
     
-    // Handle changes (Runs only once)
+    // Handle changes (Runs only once): the menu is shown half way through the transition, so it has to be complete
+    FinishStartupTasks();
     nextScene = Scene::MENU;
     transition.SetTransition(2000);
     PlaySound(Sound::CLICK);
@@ -422,8 +562,13 @@ void GameEngine::ChangeSceneFromMenuToGame() {
     StopSounds();
     LoadLevel();
     level->Reset();
-    level->Update((float)frameDelay);
-    std::string deathCaption = "x " + std::to_string(level->player->deathCount);
+    level->Update(frameStep);
+    UpdateDeathCaption();
+}
+
+void GameEngine::UpdateDeathCaption() {
+    std::pmr::string deathCaption("x ", scratch.Resource());
+    deathCaption += std::to_string(level->player->deathCount);
     deathButton->UpdateCaption(deathCaption, ENGLISH);
 }
 
@@ -437,8 +582,12 @@ void GameEngine::ChangeSceneFromGameToMenu() {
         else if (transition.IsMiddle()) {
             transition.ReachMiddle();
             level.reset(nullptr);
-            nextLevel = Level::NONE;
+            nextLevel = LevelRegistry::none;
             PlaySound(Sound::LOBBY, true);
+
+            // The menu shows the page of the first level that has not been completed yet
+            levelPage = std::min(completedLevels, levels->GetCount() - 1) / levelsPerPage;
+            UpdateLevelButtons();
         }
         return;
     }
@@ -474,8 +623,7 @@ void GameEngine::ChangeSceneFromGameToDeathToGame() {
     // Handle changes (Runs only once)
     nextScene = Scene::DEATH;
     transition.SetTransition(3000);
-    std::string deathCaption = "x " + std::to_string(level->player->deathCount);
-    deathButton->UpdateCaption(deathCaption, ENGLISH);
+    UpdateDeathCaption();
     StopSounds();
     #ifndef QUICK
     PlaySound(Sound::DEATH);
@@ -490,31 +638,34 @@ void GameEngine::ChangeSceneToNextLevel() {
         if (percentage > 1.0f) {
             transition.Deactivate();
             currentLevel = nextLevel;
-            nextLevel = Level::NONE;
+            nextLevel = LevelRegistry::none;
             nextScene = Scene::GAME;
             StopSounds();
             PlaySound(Sound::BACKGROUND, true);
-            Level::isCompleted = false;
+            World::Current().isCompleted = false;
         }
         // In the Middle
         else if (transition.IsMiddle()) {
             transition.ReachMiddle();
             LoadLevel();
-            Level::isCompleted = false;
+            World::Current().isCompleted = false;
         }
         return;
     }
     
     // Handle changes (Runs only once)
-    Level::isCompleted = false;
-    if (currentLevel > completedLevels)
-        completedLevels = currentLevel;
+    World::Current().isCompleted = false;
     nextScene = Scene::LOAD;
     transition.SetTransition(3000);
     StopSounds();
 }
 
 void GameEngine::HandleEvent(SDL_Event& event) {
+    #ifdef LATENCY
+    if (transition.IsActive() == false && ((event.type == SDL_KEYDOWN && event.key.repeat == 0) || event.type == SDL_MOUSEBUTTONDOWN))
+        latency.Tag(event.common.timestamp);
+    #endif
+
     switch (event.type) {
     case SDL_KEYDOWN:
         if (transition.IsActive())
@@ -528,19 +679,23 @@ void GameEngine::HandleEvent(SDL_Event& event) {
             input.SetEsc(true);
             break;
         case SDLK_UP:
-        case SDLK_w: input.SetW(true); break;
+        case SDLK_w: if (event.key.repeat == 0) input.Push(Input::UP, true, event.key.timestamp); break;
         case SDLK_LEFT:
-        case SDLK_a: input.SetA(true); break;
+        case SDLK_a: if (event.key.repeat == 0) input.Push(Input::LEFT, true, event.key.timestamp); break;
         case SDLK_DOWN:
-        case SDLK_s: input.SetS(true); break;
+        case SDLK_s: if (event.key.repeat == 0) input.Push(Input::DOWN, true, event.key.timestamp); break;
         case SDLK_RIGHT:
-        case SDLK_d: input.SetD(true); break;
+        case SDLK_d: if (event.key.repeat == 0) input.Push(Input::RIGHT, true, event.key.timestamp); break;
         case SDLK_p:
             if (currentScene == Scene::GAME && input.DisableP() == false)
                 PlaySound(Sound::CLICK);
             input.SetP(true);
             break;
-        case SDLK_SPACE: input.SetSpace(true); input.SetW(true); break;
+        case SDLK_SPACE:
+            input.SetSpace(true);
+            if (event.key.repeat == 0)
+                input.Push(Input::UP, true, event.key.timestamp);
+            break;
         default: break;
         }
         break;
@@ -548,15 +703,15 @@ void GameEngine::HandleEvent(SDL_Event& event) {
         switch (event.key.keysym.sym) {
         case SDLK_ESCAPE: input.SetEsc(false); input.DisableEsc() = false; break;
         case SDLK_UP:
-        case SDLK_w: input.SetW(false); if (level != nullptr) level->player->jump = false; break;
+        case SDLK_w: input.Push(Input::UP, false, event.key.timestamp); break;
         case SDLK_LEFT:
-        case SDLK_a: input.SetA(false); break;
+        case SDLK_a: input.Push(Input::LEFT, false, event.key.timestamp); break;
         case SDLK_DOWN:
-        case SDLK_s: input.SetS(false); break;
+        case SDLK_s: input.Push(Input::DOWN, false, event.key.timestamp); break;
         case SDLK_RIGHT:
-        case SDLK_d: input.SetD(false); break;
+        case SDLK_d: input.Push(Input::RIGHT, false, event.key.timestamp); break;
         case SDLK_p: input.SetP(false); input.DisableP() = false; break;
-        case SDLK_SPACE: input.SetSpace(false); input.SetW(false); break;
+        case SDLK_SPACE: input.SetSpace(false); input.Push(Input::UP, false, event.key.timestamp); break;
         default: break;
         }
         break;
@@ -582,6 +737,23 @@ void GameEngine::HandleEvent(SDL_Event& event) {
         }
         break;
     case SDL_MOUSEBUTTONUP: if (event.button.button == SDL_BUTTON_LEFT) input.SetMouseClick(false); break;
+    case SDL_WINDOWEVENT:
+        switch (event.window.event) {
+        case SDL_WINDOWEVENT_MINIMIZED:
+            isMinimized = true;
+            // Nothing is rendered, so the game is not left running unseen
+            if (currentScene == Scene::GAME && nextScene == Scene::GAME)
+                isPaused = true;
+            break;
+        case SDL_WINDOWEVENT_RESTORED:
+        case SDL_WINDOWEVENT_SHOWN:
+        case SDL_WINDOWEVENT_EXPOSED: isMinimized = false; break;
+        default: break;
+        }
+        break;
+    // The contents of the render targets are lost
+    case SDL_RENDER_TARGETS_RESET:
+    case SDL_RENDER_DEVICE_RESET: FreePausedFrame(); break;
     case SDL_QUIT:
         ExitProgram();
         break;
@@ -597,16 +769,7 @@ void GameEngine::HandleMenuButtons() {
             case Button::ENG: currentLanguage = ENGLISH; UpdateButtons(); return;
             case Button::JP: currentLanguage = JAPANESE; UpdateButtons(); return;
             case Button::HUN: currentLanguage = HUNGARIAN; UpdateButtons(); return;
-            case Button::START:
-            case Button::LVL1: nextLevel = Level::LVL1; ChangeSceneFromMenuToGame(); return;
-            case Button::LVL2:
-                if (completedLevels == Level::NONE)
-                    PlaySound(Sound::ERROR);
-                else {
-                    nextLevel = Level::LVL2;
-                    ChangeSceneFromMenuToGame();
-                }
-                return;
+            case Button::START: StartLevel(0); return;
             case Button::NONE: return;
             default:
                 std::cerr << "Wrong ButtonType: " << button->GetButtonType() << std::endl;
@@ -614,6 +777,20 @@ void GameEngine::HandleMenuButtons() {
             }
         }
     }
+
+    for (size_t slot = 0; slot < levelButtons.size(); ++slot) {
+        if (IsLevelButtonShown(slot) && levelButtons[slot]->IsClicked(input.GetMouseX(), input.GetMouseY())) {
+            PlaySound(Sound::CLICK);
+            switch (levelButtons[slot]->GetButtonType()) {
+            case Button::LEVEL: StartLevel(levelPage * levelsPerPage + slot); return;
+            case Button::PREVIOUS_PAGE: --levelPage; UpdateLevelButtons(); return;
+            case Button::NEXT_PAGE: ++levelPage; UpdateLevelButtons(); return;
+            default:
+                std::cerr << "Wrong ButtonType: " << levelButtons[slot]->GetButtonType() << std::endl;
+                throw "Wrong ButtonType!";
+            }
+        }
+    }
 }
 
 void GameEngine::HandleGameButtons() {
@@ -642,17 +819,17 @@ void GameEngine::UpdateSingeButton(Button* button) {
     if (button->IsTextBased()) {
         switch (currentLanguage) {
         case ENGLISH:
-            static_cast<TextButton*>(button)->UpdateCaption(LangMod[ENGLISH]->GetTranslation(
+            static_cast<TextButton*>(button)->UpdateCaption(GetLanguageModule(ENGLISH).GetTranslation(
                 static_cast<TextButton*>(button)->GetCaptionType()), ENGLISH);
             static_cast<TextButton*>(button)->DestroySelectBoxTexture();
             break;
         case JAPANESE:
-            static_cast<TextButton*>(button)->UpdateCaption(LangMod[JAPANESE]->GetTranslation(
+            static_cast<TextButton*>(button)->UpdateCaption(GetLanguageModule(JAPANESE).GetTranslation(
                 static_cast<TextButton*>(button)->GetCaptionType()),JAPANESE);
             static_cast<TextButton*>(button)->DestroySelectBoxTexture();
             break;
         case HUNGARIAN:
-            static_cast<TextButton*>(button)->UpdateCaption(LangMod[HUNGARIAN]->GetTranslation(
+            static_cast<TextButton*>(button)->UpdateCaption(GetLanguageModule(HUNGARIAN).GetTranslation(
                 static_cast<TextButton*>(button)->GetCaptionType()), HUNGARIAN);
             static_cast<TextButton*>(button)->DestroySelectBoxTexture();
             break;
@@ -672,16 +849,115 @@ void GameEngine::UpdateSingeButton(Button* button) {
     }
 }
 
+LanguageModule& GameEngine::GetLanguageModule(Language language) {
+    static const char* const languageFiles[] = { "lang/English.txt", "lang/Japanese.txt", "lang/Hungarian.txt" };
+
+    if (LangMod.at(language) == nullptr) {
+        std::string buffer;
+        std::string_view source = Assets::Read(languageFiles[language], buffer);
+        if (source.data() == nullptr)
+            throw "Unable to open language file!";
+        LangMod[language] = LanguageModule::Load(source, Assets::CachePath(languageFiles[language], ".lang"));
+    }
+    return *LangMod[language];
+}
+
+void GameEngine::LoadLevelRegistry(bool isRebuilt) {
+    static const char* const manifestFile = "levels/Levels.txt";
+
+    std::string buffer;
+    std::string_view manifest = Assets::Read(manifestFile, buffer);
+    if (manifest.data() == nullptr)
+        throw "Unable to open level manifest!";
+
+    // While the levels are edited, their sizes and checksums are not taken from the cache
+    #ifdef HOT_RELOAD
+    std::string cachePath;
+    #else
+    std::string cachePath = Assets::CachePath(manifestFile, ".idx");
+    #endif
+    levels = LevelRegistry::Load(manifest, cachePath, [](const std::string& path, std::string& levelBuffer) { return Assets::Read(path, levelBuffer); }, isRebuilt);
+    if (levels->GetCount() == 0)
+        throw "No levels in the manifest!";
+}
+
+void GameEngine::CreateLevelButtons() {
+    // Only the buttons of a single page exist, they show the levels of the current page
+    for (size_t slot = 0; slot < levelsPerPage; ++slot) {
+        int x = 250 + 150 * (int) (slot % levelColumns);
+        int y = 470 + 70 * (int) (slot / levelColumns);
+        levelButtons.push_back(new TextButton(Button::LEVEL, " ", x, y, BLACK, REG30, 200, false, currentLanguage));
+    }
+    levelButtons.push_back(new TextButton(Button::PREVIOUS_PAGE, "<", 190, 505, BLACK, REG30, 200));
+    levelButtons.push_back(new TextButton(Button::NEXT_PAGE, ">", 250 + 150 * (int) levelColumns, 505, BLACK, REG30, 200));
+    UpdateLevelButtons();
+}
+
+void GameEngine::UpdateLevelButtons() {
+    if (levels == nullptr)
+        return;
+    for (size_t slot = 0; slot < levelButtons.size() && slot < levelsPerPage; ++slot)
+        if (IsLevelButtonShown(slot))
+            levelButtons[slot]->UpdateCaption(GetLevelCaption(levelPage * levelsPerPage + slot), currentLanguage);
+}
+
+bool GameEngine::IsLevelButtonShown(size_t slot) const {
+    if (slot < levelsPerPage)
+        return levelPage * levelsPerPage + slot < levels->GetCount();
+    if (slot == levelsPerPage)
+        return levelPage > 0;
+    return (levelPage + 1) * levelsPerPage < levels->GetCount();
+}
+
+std::string GameEngine::GetLevelCaption(size_t index) {
+    LevelRegistry::Entry entry = levels->GetEntry(index);
+    if (entry.name.empty() == false)
+        return std::string(entry.name);
+
+    // Levels without a name are numbered: the number in the translation of "Level 1" is replaced
+    std::string caption(GetLanguageModule(currentLanguage).GetTranslation(Lang::LVL1));
+    std::string number = std::to_string(index + 1);
+    size_t digit = caption.find('1');
+    if (digit == std::string::npos)
+        return caption + " " + number;
+    return caption.replace(digit, 1, number);
+}
+
+void GameEngine::StartLevel(size_t index) {
+    if (levels == nullptr || index >= levels->GetCount() || index > completedLevels) {
+        PlaySound(Sound::ERROR);
+        return;
+    }
+    nextLevel = index;
+    ChangeSceneFromMenuToGame();
+}
+
 void GameEngine::LoadLevel() {
     level.reset(nullptr);
-    switch (nextLevel) {
-    case Level::LVL1: level.reset(new Level("../res/levels/Level1.txt", window, frameDelay)); break;
-    case Level::LVL2: level.reset(new Level("../res/levels/Level2.txt", window, frameDelay)); break;
-    case Level::NONE: throw "Level type not allowed!";
-    default: throw "Level not found!";
+    if (nextLevel >= levels->GetCount())
+        throw "Level not found!";
+    std::string path(levels->GetEntry(nextLevel).path);
+
+    // A level edited without touching the manifest (or a repacked asset pack) makes the cached index stale
+    std::string buffer;
+    std::string_view contents = Assets::Read(path, buffer);
+    if (contents.data() != nullptr && levels->Matches(nextLevel, contents) == false) {
+        std::clog << "Level has changed since the index was cached, rebuilding the index: " << path << std::endl;
+        levels.reset();     // The cache file is unmapped before it is replaced
+        LoadLevelRegistry(true);
     }
+
+    level.reset(new Level(path, window));
     if (level == nullptr)
         throw "Failed to load level!";
+    level->SetCoyoteTime(COYOTE_TIME);
+
+    // The quote button is created once, so assigning a quote does not allocate
+    level->quoteButton.reset(new TextButton(Button::NONE, " ", 0, 0, Colour::BLACK, MED15, 100, false, currentLanguage));
+    level->quoteButton->Reserve(maxQuoteLength);
+    #ifdef HOT_RELOAD
+    levelWatcher.Watch(Assets::Path(level->GetConfigFile()));
+    #endif
 }
 
 void GameEngine::ExitProgram() { exitProgram = true; }
@@ -695,261 +971,109 @@ void GameEngine::PlaySound(Sound::Type soundType, bool loop) { sounds.PlaySound(
 void GameEngine::StopSounds() { sounds.StopSound(); }
 
 void GameEngine::LoadSounds() {
-    sounds.LoadSound("../res/audio/Click.mp3", Sound::CLICK);
-    sounds.LoadSound("../res/audio/BackgroundMusic.mp3", Sound::BACKGROUND);
-    sounds.LoadSound("../res/audio/Lobby.mp3", Sound::LOBBY);
-    sounds.LoadSound("../res/audio/Death.mp3", Sound::DEATH);
-    sounds.LoadSound("../res/audio/Jump.mp3", Sound::JUMP);
-    sounds.LoadSound("../res/audio/Roar.mp3", Sound::ROAR);
-    sounds.LoadSound("../res/audio/Break.mp3", Sound::BREAK);
-    sounds.LoadSound("../res/audio/Coin.mp3", Sound::COIN);
-    sounds.LoadSound("../res/audio/Fish.mp3", Sound::FISH);
-    sounds.LoadSound("../res/audio/Sakana.mp3", Sound::SAKANA);
-    sounds.LoadSound("../res/audio/Hal.mp3", Sound::HAL);
-    sounds.LoadSound("../res/audio/Laser.mp3", Sound::LASER);
-    sounds.LoadSound("../res/audio/Pop.mp3", Sound::POP);
-    sounds.LoadSound("../res/audio/Flag.mp3", Sound::FLAG);
-    sounds.LoadSound("../res/audio/Error.mp3", Sound::ERROR);
-    sounds.LoadSound("../res/audio/Empty.mp3", Sound::EMPTY);
+    // Sound effects are loaded in the background in this order: the sounds of the title screen come first
+    sounds.LoadSound("audio/Lobby.mp3", Sound::LOBBY);
+    sounds.LoadSound("audio/Click.mp3", Sound::CLICK);
+    sounds.LoadSound("audio/Error.mp3", Sound::ERROR);
+    sounds.LoadSound("audio/BackgroundMusic.mp3", Sound::BACKGROUND);
+    sounds.LoadSound("audio/Death.mp3", Sound::DEATH);
+    sounds.LoadSound("audio/Jump.mp3", Sound::JUMP);
+    sounds.LoadSound("audio/Roar.mp3", Sound::ROAR);
+    sounds.LoadSound("audio/Break.mp3", Sound::BREAK);
+    sounds.LoadSound("audio/Coin.mp3", Sound::COIN);
+    sounds.LoadSound("audio/Fish.mp3", Sound::FISH);
+    sounds.LoadSound("audio/Sakana.mp3", Sound::SAKANA);
+    sounds.LoadSound("audio/Hal.mp3", Sound::HAL);
+    sounds.LoadSound("audio/Laser.mp3", Sound::LASER);
+    sounds.LoadSound("audio/Pop.mp3", Sound::POP);
+    sounds.LoadSound("audio/Flag.mp3", Sound::FLAG);
 }
 
 Language GameEngine::getLanguage() const { return currentLanguage; }
 
 bool GameEngine::CheckIfLevelCompleted() {
-    if (Level::isCompleted == false || transition.IsActive())
+    if (World::Current().isCompleted == false || transition.IsActive())
         return false;
 
-    switch (currentLevel) {
-    case Level::LVL1:
-        nextLevel = Level::LVL2;
+    // The levels are played in the order of the manifest, the last one leads back to the menu
+    completedLevels = std::max(completedLevels, currentLevel + 1);
+    if (currentLevel + 1 < levels->GetCount()) {
+        nextLevel = currentLevel + 1;
         ChangeSceneToNextLevel();
-        break;
-    case Level::LVL2:
-        ChangeSceneFromGameToMenu();
-        break;
-    default:
-        throw "Level not found!";
     }
+    else
+        ChangeSceneFromGameToMenu();
     return true;
 }
 
-void GameEngine::CheckForDeath() {
-    // Player leaves screen
-    if (GameObject::AABB(level->player->HitBox(), GameObject::screen) == false && level->player->HitBox().y + level->player->HitBox().h > 5) {
-        level->player->Kill();
-        // std::clog << "Player left the screen!" << std::endl;
-    }
-    // Enemy leaves screen
-    for (auto& enemy : level->enemies)
-        if(enemy->isActivated && enemy->isRemoved == false && GameObject::AABB(enemy->HitBox(), GameObject::screen) == false && enemy->HitBox().x < GameObject::screen.x + GameObject::screen.w)
-            enemy->Kill();
-    for (auto& enemy : level->tempEnemies)
-        if(enemy->isRemoved == false && GameObject::AABB(enemy->HitBox(), GameObject::screen) == false && enemy->HitBox().x < GameObject::screen.x + GameObject::screen.w)
-            enemy->Kill();
-    // Level Element leaves screen
-    for (auto& element : level->elements)
-        if (element->isActivated && element->isRemoved == false && GameObject::AABB(element->HitBox(), GameObject::screen) == false && element->HitBox().x < GameObject::screen.x + GameObject::screen.w)
-            element->isRemoved = true;
-}
-
-void GameEngine::CheckForCollision() {
-    // Player <==> Blocks
-    if (level->player->IsDead() == false && level->player->isGiga == false)
-        level->grid.CheckCollision(level->player.get());
-
-    // Enemies <==> Blocks
-    for (auto& enemy : level->enemies)
-        if (enemy->isActivated && enemy->isRemoved == false)
-            level->grid.CheckCollision(enemy.get());
-    
-    for (auto& enemy : level->tempEnemies)
-        if (enemy->isRemoved == false)
-            level->grid.CheckCollision(enemy.get());
-
-    // Player <==> Enemies
-    for (auto& enemy : level->enemies)
-        if (enemy->isActivated && enemy->IsDead() == false && GameObject::AABB(level->player->HitBox(), enemy->HitBox()))
-            level->player->Touch(enemy.get());
-
-    for (auto& enemy : level->tempEnemies)
-        if (enemy->IsDead() == false && GameObject::AABB(level->player->HitBox(), enemy->HitBox()))
-            level->player->Touch(enemy.get());
-
-    // Enemies <==> Enemies
-    for (auto& enemy : level->enemies)
-        for (auto& other : level->enemies)
-            if (enemy != other && enemy->IsDead() == false && other->IsDead() == false && enemy->isActivated && other->isActivated)
-                if (GameObject::AABB(enemy->HitBox(), other->HitBox()))
-                    enemy->Touch(other.get());
-    
-    for (auto& enemy : level->enemies)
-        for (auto& other : level->tempEnemies)
-            if (enemy->IsDead() == false && other->IsDead() == false && enemy->isActivated)
-                if (GameObject::AABB(enemy->HitBox(), other->HitBox())) {
-                    enemy->Touch(other.get());
-                    other->Touch(enemy.get());  // necessary for handling all interactions
-                }
-
-    for (auto& enemy : level->tempEnemies)
-        for (auto& other : level->tempEnemies)
-            if (enemy != other && enemy->IsDead() == false && other->IsDead() == false)
-                if (GameObject::AABB(enemy->HitBox(), other->HitBox()))
-                    enemy->Touch(other.get());
-    
-    // Player <==> Elements
-    for (auto& element : level->elements)
-        if (GameObject::AABB(level->player->HitBox(), element->HitBox()) && level->player->IsDead() == false)
-            level->player->Touch(element.get());
-
-    // Enemies <==> Elements
-    for (auto& enemy : level->enemies)
-        for (auto& element : level->elements)
-            if (enemy->IsDead() == false && enemy->isActivated && element->isActivated && element->isRemoved == false)
-                if (GameObject::AABB(enemy->HitBox(), element->HitBox()))
-                    enemy->Touch(element.get());
-
-    for (auto& enemy : level->tempEnemies)
-        for (auto& element : level->elements)
-            if (enemy->IsDead() == false && element->isActivated && element->isRemoved == false)
-                if (GameObject::AABB(enemy->HitBox(), element->HitBox()))
-                    enemy->Touch(element.get());
-
-    if (level->player->hasCollided == false && level->player->jump == false && level->player->jumpTime.IsActive() == false)
-        level->player->GetRigidBody().ApplyForceY(0.0f);
-    if (level->player->onGround && input.GetRight() == input.GetLeft() && level->player->isForcedByFlag == false)
-        level->player->GetRigidBody().Velocity() *= 0.9f;
+PlayerInput GameEngine::GetPlayerInput() const {
+    PlayerInput playerInput;
+    playerInput.left = input.GetLeft();
+    playerInput.right = input.GetRight();
+    playerInput.up = input.GetUp();
+    playerInput.down = input.GetDown();
+    playerInput.upReleased = input.IsHeld(Input::UP) == false;
+    return playerInput;
 }
 
-void GameEngine::CheckForAnimation() {
-    // Block Sounds and Animations
-    int startColumn = GameObject::screen.x / level->grid.blockSize;
-    int endColumn = (GameObject::screen.x + GameObject::screen.w) / level->grid.blockSize + 1;
-    if (startColumn < 0) startColumn = 0;
-    if (endColumn > level->grid.width) endColumn = level->grid.width;
-
-    for (int row=0; row < level->grid.height; ++row) {
-        for (int column=startColumn; column < endColumn; ++column) {
-            if (level->grid.blocks.at(row * level->grid.width + column) != nullptr) {
-                // Hidden Block
-                if (HiddenBlock* block = dynamic_cast<HiddenBlock*>(level->grid.blocks.at(row * level->grid.width + column).get())) {
-                    if (block->playAnimation) {
-                        block->playAnimation = false;
-                        PlaySound(Sound::COIN);
-                        level->animation.AddCoin(block->HitBox().x + (block->HitBox().w / 2), block->HitBox().y);
-
-                        // Limit Player's speed for pleasant memories
-                        level->player->GetRigidBody().ApplyVelocityX(0.0f);
-                    }
-                }
-                // Brick Block
-                else if (BrickBlock* block = dynamic_cast<BrickBlock*>(level->grid.blocks.at(row * level->grid.width + column).get())) {
-                    if (block->playAnimation) {
-                        block->playAnimation = false;
-                        PlaySound(Sound::BREAK);
-                    }
-                }
-                // Mystery Block
-                else if (MysteryBlock* block = dynamic_cast<MysteryBlock*>(level->grid.blocks.at(row * level->grid.width + column).get())) {
-                    if (block->playAnimation) {
-                        block->playAnimation = false;
-
-                        // Add Coin or Spawn Random Enemy
-                        switch (std::rand() % 10) {
-                        // Common Enemy
-                        case 0: level->tempEnemies.push_back(
-                            std::make_unique<CommonEnemy>((SDL_Rect){block->HitBox().x, block->HitBox().y-75, 75, 68}, 0,
-                            (SDL_Rect){0, 68, 30, 27}, 30, (SDL_Rect){block->HitBox().x, block->HitBox().y-75, 75, 68}, false));
-                            break;
-                        // Soldier Enemy
-                        case 1: level->tempEnemies.push_back(
-                            std::make_unique<SoldierEnemy>((SDL_Rect){block->HitBox().x, block->HitBox().y-100, 75, 92}, 0,
-                            (SDL_Rect){0, 95, 30, 38}, 30, (SDL_Rect){block->HitBox().x, block->HitBox().y-100, 75, 92}, false));
-                            break;
-                        // King Enemy
-                        case 2: level->tempEnemies.push_back(
-                            std::make_unique<KingEnemy>((SDL_Rect){block->HitBox().x, block->HitBox().y-75, 80, 82}, 0,
-                            (SDL_Rect){60, 68, 32, 33}, 32, (SDL_Rect){block->HitBox().x, block->HitBox().y-75, 80, 82}, false));
-                            break;
-                        // Red Mushroom Enemy
-                        case 3: level->tempEnemies.push_back(
-                            std::make_unique<RedMushroomEnemy>((SDL_Rect){block->HitBox().x, block->HitBox().y-75, 73, 73}, 0,
-                            (SDL_Rect){62, 131, 29, 29}, 29, (SDL_Rect){block->HitBox().x, block->HitBox().y-75, 73, 73}, false));
-                            break;
-                        // Purple Mushroom Enemy
-                        case 4: level->tempEnemies.push_back(
-                            std::make_unique<PurpleMushroomEnemy>((SDL_Rect){block->HitBox().x, block->HitBox().y-75, 73, 75}, 0,
-                            (SDL_Rect){63, 101, 29, 30}, 29, (SDL_Rect){block->HitBox().x, block->HitBox().y-75, 73, 75}, false));
-                            break;
-
-                        default:
-                            PlaySound(Sound::COIN);
-                            level->animation.AddCoin(block->HitBox().x + (block->HitBox().w / 2), block->HitBox().y);
-                            break;
-                        }
-                    }
-                }
-            }
-        }
-    }
-
-    // Check for Roar Sound
-    if (level->player->playSound && level->player->isGiga) {
-        level->player->playSound = false;
-        sounds.PlaySound(Sound::ROAR);
-    }
-    // Check for Enemy Sounds
-    for (auto& enemy : level->enemies) {
-        if (enemy->playSound) {
-            enemy->playSound = false;
-            sounds.PlaySound(Sound::POP);
-        }
-    }
-    for (auto& enemy : level->tempEnemies) {
-        if (enemy->playSound) {
-            enemy->playSound = false;
-            sounds.PlaySound(Sound::POP);
-        }
-    }
-    // Check for Element Sounds
-    for (auto& element : level->elements) {
-        if (element->playSound) {
-            element->playSound = false;
-            if (dynamic_cast<Fish*>(element.get())) {
-                switch (currentLanguage) {
-                case ENGLISH: PlaySound(Sound::FISH); break;
-                case JAPANESE: PlaySound(Sound::SAKANA); break;
-                case HUNGARIAN: PlaySound(Sound::HAL); break;
-                default:
-                    throw "Language not found!";
-                }
-            }
-            else if (dynamic_cast<Laser*>(element.get()))
-                PlaySound(Sound::LASER);
-            else if (dynamic_cast<EndFlag*>(element.get())) {
-                StopSounds();
-                PlaySound(Sound::FLAG);
+void GameEngine::HandleLevelEvents() {
+    ALLOC_SCOPE("GameEngine::HandleLevelEvents");
+    for (const LevelEvent& event : level->GetEvents()) {
+        switch (event.type) {
+        case LevelEvent::JUMP:
+            input.ConsumeJump();
+            PlaySound(Sound::JUMP);
+            break;
+        case LevelEvent::COIN:
+            PlaySound(Sound::COIN);
+            level->particles.EmitCoin(event.x, event.y);
+            break;
+        case LevelEvent::BREAK:
+            PlaySound(Sound::BREAK);
+            level->particles.EmitDebris(event.x, event.y);
+            break;
+        case LevelEvent::ROAR: PlaySound(Sound::ROAR); break;
+        case LevelEvent::POP:
+            PlaySound(Sound::POP);
+            level->particles.EmitPop(event.x, event.y);
+            break;
+        case LevelEvent::FISH:
+            switch (currentLanguage) {
+            case ENGLISH: PlaySound(Sound::FISH); break;
+            case JAPANESE: PlaySound(Sound::SAKANA); break;
+            case HUNGARIAN: PlaySound(Sound::HAL); break;
+            default:
+                throw "Language not found!";
             }
-            else
-                throw "Unknown Level Element!";
+            break;
+        case LevelEvent::LASER: PlaySound(Sound::LASER); break;
+        case LevelEvent::FLAG:
+            StopSounds();
+            PlaySound(Sound::FLAG);
+            break;
+        default:
+            throw "Level event not found!";
         }
     }
+    level->GetEvents().clear();
 }
 
 void GameEngine::AssignQuote() {
-    if (level->enemyWithQuote == nullptr || level->enemyWithQuote->IsDead()) {
+    ALLOC_SCOPE("GameEngine::AssignQuote");
+    if (level->enemyWithQuote != nullptr && level->enemyWithQuote->IsDead())
         level->enemyWithQuote = nullptr;
-        level->quoteButton.reset();
-    }
 
     // Search for new enemy for Quote
     if (level->enemyWithQuote == nullptr) {
         Enemy* leftMostEnemy = nullptr;
-        for (auto& enemy : level->enemies)
-            if ((enemy->IsDead() == false && enemy->isActivated && enemy->HitBox().x - GameObject::screen.x > 0) && (leftMostEnemy == nullptr || (enemy->HitBox().x < leftMostEnemy->HitBox().x)))
-                leftMostEnemy = enemy.get();
+        for (size_t i : level->activeEnemies) {
+            Enemy* enemy = level->enemies[i].get();
+            if ((enemy->IsDead() == false && enemy->HitBox().x - GameObject::Screen().x > 0) && (leftMostEnemy == nullptr || (enemy->HitBox().x < leftMostEnemy->HitBox().x)))
+                leftMostEnemy = enemy;
+        }
         
         for (auto& enemy : level->tempEnemies)
-            if ((enemy->IsDead() == false && enemy->HitBox().x - GameObject::screen.x > 0) && (leftMostEnemy == nullptr || (enemy->HitBox().x < leftMostEnemy->HitBox().x)))
+            if ((enemy->IsDead() == false && enemy->HitBox().x - GameObject::Screen().x > 0) && (leftMostEnemy == nullptr || (enemy->HitBox().x < leftMostEnemy->HitBox().x)))
                 leftMostEnemy = enemy.get();
 
         if (leftMostEnemy == nullptr)
@@ -957,43 +1081,23 @@ void GameEngine::AssignQuote() {
 
         level->enemyWithQuote = leftMostEnemy;
         
-        level->quote = LangMod[currentLanguage]->GetRandomQuote();
-    }
-    // Update quote
-    if (level->enemyWithQuote != nullptr) {
-        level->quoteButton.reset(new TextButton(Button::NONE, level->quote.quote,
-            level->enemyWithQuote->HitBox().x + level->enemyWithQuote->HitBox().w - GameObject::screen.x + 5,
-            level->enemyWithQuote->HitBox().y - GameObject::screen.y, Colour::BLACK, MED15, 100, false, currentLanguage));
+        level->quote = GetLanguageModule(currentLanguage).GetRandomQuote();
+        level->quoteButton->UpdateCaption(level->quote.quote, currentLanguage);
     }
-}
-
-void GameEngine::RecoverPosition() {
-    if (level->player->recoverX)
-        level->player->HitBox().x = level->player->previousPosition.x;
-    if (level->player->recoverY)
-        level->player->HitBox().y = level->player->previousPosition.y;
+    // Update quote (the button of the level is reused, it only follows the enemy)
+    int x = level->enemyWithQuote->HitBox().x + level->enemyWithQuote->HitBox().w - GameObject::Screen().x + 5;
+    int y = level->enemyWithQuote->HitBox().y - GameObject::Screen().y;
+    level->quoteButton->SetPosition(x, y);
 }
 
 void GameEngine::UpdateRects() {
-    // Dest Rect
-    level->player->UpdateDestRect();
-    level->grid.UpdateDestRect();
-
-    for (auto& enemy : level->enemies)
-        enemy->UpdateDestRect();
-    for (auto& enemy : level->tempEnemies)
-        enemy->UpdateDestRect();
-
-    for (auto& element : level->elements)
-        element->UpdateDestRect();
-
-    // Previous Position
+    // Systems: single linear passes over the visible blocks and the active objects (the rest of the level is not visited)
+    Components& components = level->world.components;
+    level->CollectEnemyIds();
+    level->CollectVisibleIds();
+    components.UpdateDestRects(level->visibleIds, level->world.screen);
+    components.UpdatePreviousPositions(level->enemyIds);
     level->player->UpdatePreviousPosition();
-
-    for (auto& enemy : level->enemies)
-        enemy->UpdatePreviousPosition();
-    for (auto& enemy : level->tempEnemies)
-        enemy->UpdatePreviousPosition();
 }
 
 void GameEngine::DrawDeathCount() {
@@ -1005,10 +1109,26 @@ void GameEngine::DrawDeathCount() {
 }
 
 int GameEngine::GetTransparency() { return transition.GetTransparency(); }
+
+int GameEngine::GetUpdateCycles() {
+    Uint32 elapsed = frameStart - lastUpdate;
+    lastUpdate = frameStart;
+    if (isVsync == false)
+        return 1;
+
+    // After a pause (or a long frame) the simulation is not caught up, it continues with a single cycle
+    updateLag = elapsed > maxUpdateCycles * frameStep ? frameStep : updateLag + elapsed;
+    int cycles = (int) (updateLag / frameStep);
+    updateLag -= cycles * frameStep;
+    return cycles;
+}
 /* ************************************************************************************ */
 
 /***** Destructor *****/
 GameEngine::~GameEngine() {
+    Texture::loader = nullptr;
+    FreePausedFrame();
+
     if (titleButton != nullptr)
         delete titleButton;
     if (deathButton != nullptr)
@@ -1018,10 +1138,17 @@ GameEngine::~GameEngine() {
         delete button;
     for (Button* button : gameButtons)
         delete button;
-    
-    for (LanguageModule* lang : LangMod)
-        delete lang;
-    
+    for (TextButton* button : levelButtons)
+        delete button;
+
+    if (printPacingReport)
+        pacer.Report(std::clog);
+    #ifdef LATENCY
+    latency.Report(std::clog);
+    #endif
+    #ifdef ALLOC_TRACK
+    AllocTracker::Report(std::clog);
+    #endif
     
     #ifdef DTOR
     std::clog << "~GameEngine Dtor" << std::endl;
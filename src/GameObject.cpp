@@ -15,12 +15,16 @@
 #include "Texture.h"
 #include "RigidBody.h"
 #include "Entity.h"
+#include "World.h"
+#include "Components.h"
+#include "Arena.h"
 
 RenderWindow* GameObject::window = nullptr;
-SDL_Rect GameObject::screen = {0,0,0,0};
 /* ************************************************************************************ */
 
 /***** Static Functions *****/
+SDL_Rect& GameObject::Screen() { return World::Current().screen; }
+
 bool GameObject::AABB(const SDL_Rect& A, const SDL_Rect& B) {
     if (A.x + A.w >= B.x && A.x <= B.x + B.w && A.y + A.h >= B.y && A.y <= B.y + B.h)
         return true;
@@ -75,24 +79,33 @@ bool GameObject::JumpedOnHead(const SDL_Rect& player, const SDL_Rect& enemy) {
 /* ************************************************************************************ */
 
 /***** Class GameObject *****/
-GameObject::GameObject(SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect, SDL_Texture* texture, bool isRemoved)
-    : texture(texture, srcRect, destRect, true), hitBox(hitBox), isRemoved(isRemoved)
+void* GameObject::operator new(size_t size) { return Arena::New(size); }
+
+void GameObject::operator delete(void* memory) { Arena::Delete(memory); }
+
+GameObject::GameObject(ObjectKind::Kind kind, SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect, SDL_Texture* texture, bool isRemoved)
+    : components(&World::Current().components), id(components->Create(kind, hitBox, Texture(texture, srcRect, destRect, true), isRemoved))
     {
     //
 }
 
-SDL_Rect& GameObject::HitBox() { return hitBox; }
+GameObject::GameObject(const GameObject& other) : components(&World::Current().components), id(other.id) {
+    // Two objects sharing a slot would free it twice
+    if (components == other.components)
+        throw "Game object copied within its own world!";
+}
 
 void GameObject::UpdateDestRect() {
-    texture.DestRect().x = hitBox.x - screen.x;
-    texture.DestRect().y = hitBox.y - screen.y;
+    Sprite().DestRect().x = HitBox().x - Screen().x;
+    Sprite().DestRect().y = HitBox().y - Screen().y;
 
     if (dynamic_cast<Entity*>(this)) {
-        texture.DestRect().y -= 1;
+        Sprite().DestRect().y -= 1;
     }
 }
 
 GameObject::~GameObject() {
+    components->Destroy(id);
     #ifdef DTOR
     std::clog << "~GameObject Dtor" << std::endl;
     #endif
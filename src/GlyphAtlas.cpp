@@ -0,0 +1,170 @@
+/** @file GlyphAtlas.cpp
+  * @brief Contains the implementation of GlyphAtlas.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef CPORTA
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+
+#include "GlyphAtlas.h"
+#include "Texture.h"
+#include "AllocTracker.h"
+
+GlyphAtlas::GlyphAtlas(TTF_Font* font, int pageSize)
+    : font(font), pageSize(pageSize), shelfX(0), shelfY(0), shelfHeight(0)
+    {
+    if (font == nullptr || pageSize <= 0)
+        throw "Invalid glyph atlas!";
+}
+
+GlyphAtlas::Layout GlyphAtlas::Typeset(std::string_view text) {
+    Layout layout;
+    Typeset(text, layout);
+    return layout;
+}
+
+void GlyphAtlas::Typeset(std::string_view text, Layout& layout) {
+    layout.quads.clear();
+    layout.width = 0;
+    layout.height = TTF_FontHeight(font);
+
+    int penX = 0;
+    size_t index = 0;
+    while (index < text.size()) {
+        size_t begin = index;
+        Uint32 codepoint = NextCodepoint(text, index);
+        const Glyph& glyph = GetGlyph(codepoint, text.substr(begin, index - begin));
+
+        if (glyph.srcRect.w > 0) {
+            layout.quads.push_back({ glyph.page, glyph.srcRect, { penX, 0, glyph.srcRect.w, glyph.srcRect.h } });
+            layout.width = std::max(layout.width, penX + glyph.srcRect.w);
+        }
+        penX += glyph.advance;
+    }
+    layout.width = std::max(layout.width, penX);
+}
+
+void GlyphAtlas::Draw(const Layout& layout, int x, int y, SDL_Color colour) {
+    for (SDL_Texture* page : pages)
+        SDL_SetTextureColorMod(page, colour.r, colour.g, colour.b);
+
+    // Consecutive copies from the same page are batched by the renderer
+    for (const Quad& quad : layout.quads) {
+        SDL_Rect destRect = { x + quad.destRect.x, y + quad.destRect.y, quad.destRect.w, quad.destRect.h };
+        SDL_RenderCopy(Texture::renderer, pages[quad.page], &quad.srcRect, &destRect);
+    }
+}
+
+Uint32 GlyphAtlas::NextCodepoint(std::string_view text, size_t& index) {
+    const Uint32 replacement = 0xFFFD;
+    unsigned char first = text[index++];
+    if (first < 0x80)
+        return first;
+
+    int length;
+    Uint32 codepoint;
+    if ((first & 0xE0) == 0xC0) { length = 1; codepoint = first & 0x1F; }
+    else if ((first & 0xF0) == 0xE0) { length = 2; codepoint = first & 0x0F; }
+    else if ((first & 0xF8) == 0xF0) { length = 3; codepoint = first & 0x07; }
+    else return replacement;
+
+    for (int i = 0; i < length; ++i) {
+        if (index >= text.size() || ((unsigned char) text[index] & 0xC0) != 0x80)
+            return replacement;
+        codepoint = (codepoint << 6) | ((unsigned char) text[index++] & 0x3F);
+    }
+    return codepoint;
+}
+
+size_t GlyphAtlas::GetGlyphCount() const { return glyphs.size(); }
+
+size_t GlyphAtlas::GetPageCount() const { return pages.size(); }
+
+GlyphAtlas::~GlyphAtlas() {
+    for (SDL_Texture* page : pages)
+        SDL_DestroyTexture(page);
+
+    #ifdef DTOR
+    std::clog << "~GlyphAtlas Dtor" << std::endl;
+    #endif
+}
+/* ************************************************************************************ */
+
+/***** Private Functions *****/
+const GlyphAtlas::Glyph& GlyphAtlas::GetGlyph(Uint32 codepoint, std::string_view utf8) {
+    auto found = glyphs.find(codepoint);
+    if (found != glyphs.end())
+        return found->second;
+
+    ALLOC_CACHE_SCOPE("GlyphAtlas::GetGlyph");
+    Glyph glyph = { 0, {0, 0, 0, 0}, 0 };
+
+    // The glyph is rendered like a single-character text, so it is positioned the same way as whole captions were
+    const SDL_Color white = {255, 255, 255, 255};
+    SDL_Surface* surface = TTF_RenderUTF8_Blended(font, std::string(utf8).c_str(), white);
+    if (surface != nullptr && surface->format->format != SDL_PIXELFORMAT_ARGB8888) {
+        SDL_Surface* converted = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+        SDL_FreeSurface(surface);
+        surface = converted;
+    }
+
+    int minX, maxX, minY, maxY, advance;
+    if (codepoint <= 0xFFFF && TTF_GlyphMetrics(font, (Uint16) codepoint, &minX, &maxX, &minY, &maxY, &advance) == 0)
+        glyph.advance = advance;
+    else if (surface != nullptr)
+        glyph.advance = surface->w;
+
+    if (surface != nullptr && surface->w > 0 && surface->h > 0) {
+        if (Pack(surface->w, surface->h, glyph.page, glyph.srcRect))
+            SDL_UpdateTexture(pages[glyph.page], &glyph.srcRect, surface->pixels, surface->pitch);
+        else
+            SDL_Log("Glyph U+%04X does not fit in the atlas!\n", (unsigned) codepoint);
+    }
+    SDL_FreeSurface(surface);
+
+    return glyphs.emplace(codepoint, glyph).first->second;
+}
+
+bool GlyphAtlas::Pack(int w, int h, size_t& page, SDL_Rect& rect) {
+    const int gap = 1;  // Keeps the neighbouring glyphs from bleeding into each other
+    if (w + gap > pageSize || h + gap > pageSize)
+        return false;
+
+    // New row
+    if (shelfX + w + gap > pageSize) {
+        shelfY += shelfHeight;
+        shelfX = 0;
+        shelfHeight = 0;
+    }
+    // New page
+    if (pages.empty() || shelfY + h + gap > pageSize) {
+        SDL_Texture* texture = SDL_CreateTexture(Texture::renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, pageSize, pageSize);
+        if (texture == nullptr) {
+            SDL_Log("Failed to create glyph atlas page! %s\n", SDL_GetError());
+            return false;
+        }
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+        pages.push_back(texture);
+        shelfX = 0;
+        shelfY = 0;
+        shelfHeight = 0;
+    }
+
+    page = pages.size() - 1;
+    rect = { shelfX, shelfY, w, h };
+    shelfX += w + gap;
+    shelfHeight = std::max(shelfHeight, h + gap);
+    return true;
+}
+
+#endif // CPORTA
@@ -0,0 +1,162 @@
+/** @file ImageLoader.cpp
+  * @brief Contains the implementation of ImageLoader.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef CPORTA
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_image.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <cstdint>
+
+#include "ImageLoader.h"
+#include "Assets.h"
+#include "PixelCache.h"
+#include "StartupReport.h"
+
+/***** Struct Image *****/
+ImageLoader::Image::~Image() {
+    if (surface != nullptr)
+        SDL_FreeSurface(surface);
+}
+/* ************************************************************************************ */
+
+/***** Class ImageLoader *****/
+ImageLoader::ImageLoader(Uint32 format, const std::vector<std::string>& paths, int workerCount) : format(format), busyWorkers(0), isStopping(false) {
+    if (workerCount <= 0)
+        workerCount = std::clamp((int) std::thread::hardware_concurrency() - 1, 1, 4);
+
+    // SDL_image loads its decoders when they are first used, which must not happen on several threads at once
+    IMG_Init(IMG_INIT_PNG);
+
+    for (const std::string& path : paths)
+        Request(path);
+    for (int i = 0; i < workerCount; ++i)
+        workers.emplace_back(&ImageLoader::DecodeQueuedImages, this, i + 1);
+}
+
+void ImageLoader::Request(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (isDone.count(path) > 0)
+        return;
+    isDone[path] = false;
+    queue.push_back(path);
+    wakeUp.notify_one();
+}
+
+std::shared_ptr<const ImageLoader::Image> ImageLoader::Get(const std::string& path) {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto it = isDone.find(path);
+    if (it == isDone.end())
+        return nullptr;
+
+    // It is needed now: if no worker has started it yet, it is decoded next
+    if (it->second == false) {
+        auto queued = std::find(queue.begin(), queue.end(), path);
+        if (queued != queue.end()) {
+            queue.erase(queued);
+            queue.push_front(path);
+        }
+        decoded.wait(lock, [this, &path]() { return isDone[path]; });
+    }
+    return images[path];
+}
+
+bool ImageLoader::IsIdle() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return queue.empty() && busyWorkers == 0;
+}
+
+std::shared_ptr<const ImageLoader::Image> ImageLoader::Decode(const std::string& path, Uint32 format) {
+    std::string buffer;
+    std::string_view source = Assets::Read(path, buffer);
+    if (source.data() == nullptr) {
+        std::cerr << "Image not found: " << path << std::endl;
+        return nullptr;
+    }
+
+    std::uint64_t hash = PixelCache::Hash(source);
+    std::string cachePath = Assets::CachePath(path);
+
+    auto image = std::make_shared<Image>();
+    image->cache = std::make_unique<PixelCache>();
+    if (image->cache->Open(cachePath, hash, format)) {
+        const PixelCache::Header& header = image->cache->GetHeader();
+        image->width = header.width;
+        image->height = header.height;
+        image->pitch = header.pitch;
+        image->pixels = image->cache->GetPixels();
+        return image;
+    }
+    image->cache.reset();
+
+    // Cache miss: decode the image, convert it to the native format and write the cache
+    SDL_Surface* surface = IMG_Load_RW(SDL_RWFromConstMem(source.data(), source.size()), 1);
+    if (surface == nullptr)
+        return nullptr;
+    image->surface = SDL_ConvertSurfaceFormat(surface, format, 0);
+    SDL_FreeSurface(surface);
+    if (image->surface == nullptr)
+        return nullptr;
+
+    image->width = image->surface->w;
+    image->height = image->surface->h;
+    image->pitch = image->surface->pitch;
+    image->pixels = image->surface->pixels;
+    if (!PixelCache::Store(cachePath, { {}, 0, hash, format, image->width, image->height, image->pitch }, image->pixels))
+        std::cerr << "Failed to write texture cache: " << cachePath << std::endl;
+    return image;
+}
+
+ImageLoader::~ImageLoader() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isStopping = true;
+    }
+    wakeUp.notify_all();
+    for (std::thread& worker : workers)
+        worker.join();
+
+    #ifdef DTOR
+    std::clog << "~ImageLoader Dtor" << std::endl;
+    #endif
+}
+/* ************************************************************************************ */
+
+/***** Private Functions *****/
+void ImageLoader::DecodeQueuedImages(int index) {
+    std::string thread = "decoder " + std::to_string(index);
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wakeUp.wait(lock, [this]() { return isStopping || !queue.empty(); });
+        if (isStopping)
+            return;
+
+        std::string path = queue.front();
+        queue.pop_front();
+        ++busyWorkers;
+
+        // Decoding takes long, the other workers and the main thread can go on meanwhile
+        lock.unlock();
+        std::shared_ptr<const Image> image;
+        {
+            StartupReport::Scope scope(path, thread);
+            image = Decode(path, format);
+        }
+        lock.lock();
+
+        images[path] = image;
+        isDone[path] = true;
+        --busyWorkers;
+        decoded.notify_all();
+    }
+}
+/* ************************************************************************************ */
+
+#endif // CPORTA
@@ -5,12 +5,42 @@
 */
 
 #include <iostream>
+#include <cstdint>
 
 #include "Input.h"
 
-Input::Input() : MouseX(0), MouseY(0), MouseClick(false), Esc(false),
-    W(false), A(false), S(false), D(false), P(false), Space(false),
-    disableEsc(false), disableP(false) {}
+Input::Input(std::uint32_t jumpBuffer) : MouseX(0), MouseY(0), MouseClick(false), Esc(false),
+    P(false), Space(false), disableEsc(false), disableP(false), firstEvent(0), eventCount(0), held{}, tapped{},
+    jumpBuffer(jumpBuffer), jumpPending(false), jumpPressedAt(0) {}
+
+void Input::Push(Key key, bool pressed, std::uint32_t timestamp) {
+    if (eventCount == queueSize) {
+        Apply(events[firstEvent]);
+        firstEvent = (firstEvent + 1) % queueSize;
+        --eventCount;
+    }
+    events[(firstEvent + eventCount) % queueSize] = { key, pressed, timestamp };
+    ++eventCount;
+}
+
+void Input::Consume(std::uint32_t now) {
+    for (bool& key : tapped)
+        key = false;
+
+    while (eventCount > 0 && events[firstEvent].timestamp <= now) {
+        Apply(events[firstEvent]);
+        firstEvent = (firstEvent + 1) % queueSize;
+        --eventCount;
+    }
+
+    // The jump was pressed too long ago (a press during this cycle is still counted by tapped)
+    if (jumpPending && now - jumpPressedAt > jumpBuffer)
+        jumpPending = false;
+}
+
+void Input::ConsumeJump() { jumpPending = false; }
+
+bool Input::IsHeld(Key key) const { return held[key]; }
 
 int Input::GetMouseX() const { return MouseX; }
 
@@ -20,13 +50,13 @@ bool Input::GetMouseClick() const { return MouseClick; }
 
 bool Input::GetEsc() const { return Esc; }
 
-bool Input::GetUp() const { return W; }
+bool Input::GetUp() const { return held[UP] || tapped[UP] || jumpPending; }
 
-bool Input::GetLeft() const { return A; }
+bool Input::GetLeft() const { return held[LEFT] || tapped[LEFT]; }
 
-bool Input::GetDown() const { return S; }
+bool Input::GetDown() const { return held[DOWN] || tapped[DOWN]; }
 
-bool Input::GetRight() const { return D; }
+bool Input::GetRight() const { return held[RIGHT] || tapped[RIGHT]; }
 
 bool Input::GetPause() const { return P; }
 
@@ -40,14 +70,6 @@ void Input::SetMouseClick(bool pressed) { MouseClick = pressed; }
 
 void Input::SetEsc(bool pressed) { Esc = pressed; }
 
-void Input::SetW(bool pressed) { W = pressed; }
-
-void Input::SetA(bool pressed) { A = pressed; }
-
-void Input::SetS(bool pressed) { S = pressed; }
-
-void Input::SetD(bool pressed) { D = pressed; }
-
 void Input::SetP(bool pressed) { P = pressed; }
 
 void Input::SetSpace(bool pressed) { Space = pressed; }
@@ -56,6 +78,17 @@ bool& Input::DisableEsc() { return disableEsc; }
 
 bool& Input::DisableP() { return disableP; }
 
+void Input::Apply(const Event& event) {
+    held[event.key] = event.pressed;
+    if (event.pressed) {
+        tapped[event.key] = true;
+        if (event.key == UP) {
+            jumpPending = true;
+            jumpPressedAt = event.timestamp;
+        }
+    }
+}
+
 Input::~Input() {
     #ifdef DTOR
     std::clog << "~Input Dtor" << std::endl;
@@ -6,21 +6,73 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
+#include <memory>
 #include <fstream>
 #include <sstream>
 #include <random>
 #include <ctime>
+#include <cstring>
+#include <cstdint>
 
 #include "LanguageModule.h"
+#include "PixelCache.h"
 
-LanguageModule::LanguageModule(std::string path) {
+/***** Class CStringView *****/
+CStringView::CStringView() : std::string_view("", 0) {}
+
+CStringView::CStringView(const char* data, size_t length) : std::string_view(data, length) {}
+
+const char* CStringView::c_str() const { return data(); }
+/* ************************************************************************************ */
+
+/***** Class LanguageModule *****/
+const std::uint32_t LanguageModule::version = 1;
+
+LanguageModule::LanguageModule(std::string path) : LanguageModule() {
     // Open file
     std::ifstream file(path);
     if (!file)
         throw std::runtime_error("Unable to open language file!");
 
-    // Read quote count
+    compiled = Compile(file);
+    Attach(compiled);
+}
+
+LanguageModule::LanguageModule(std::istream& file) : LanguageModule() {
+    compiled = Compile(file);
+    Attach(compiled);
+}
+
+std::unique_ptr<LanguageModule> LanguageModule::Load(std::string_view source, const std::string& cachePath) {
+    std::unique_ptr<LanguageModule> language(new LanguageModule());
+    std::uint64_t hash = PixelCache::Hash(source);
+
+    // The string table is stored as a single row of bytes
+    auto mapping = std::make_unique<PixelCache>();
+    if (mapping->Open(cachePath, hash, version)) {
+        const PixelCache::Header& cacheHeader = mapping->GetHeader();
+        if (language->Attach(std::string_view((const char*) mapping->GetPixels(), cacheHeader.pitch))) {
+            language->mapping = std::move(mapping);
+            return language;
+        }
+    }
+
+    // Cache miss: compile the text and write the cache
+    std::istringstream file{std::string(source)};
+    language->compiled = Compile(file);
+    std::int32_t size = (std::int32_t) language->compiled.size();
+    if (!PixelCache::Store(cachePath, { {}, 0, hash, version, size, 1, size }, language->compiled.data()))
+        std::cerr << "Failed to write language cache: " << cachePath << std::endl;
+    language->Attach(language->compiled);
+    return language;
+}
+
+std::string LanguageModule::Compile(std::istream& file) {
+    std::vector<std::string> lines;
+
+    // Read caption count
     size_t captionCount;
     if (!(file >> captionCount))
         throw std::runtime_error("Failed to read caption count!");
@@ -31,11 +83,9 @@ LanguageModule::LanguageModule(std::string path) {
     for (size_t i = 0; i < captionCount; ++i) {
         if (!std::getline(file, line))
             throw std::runtime_error("Failed to read caption line " + std::to_string(i));
-        captions.push_back(line);
+        lines.push_back(line);
     }
-    if (captions.size() != captionCount)
-        throw std::runtime_error("Caption count does no match");
-    
+
     // Read quote count
     size_t quoteCount;
     if (!(file >> quoteCount))
@@ -45,35 +95,96 @@ LanguageModule::LanguageModule(std::string path) {
     // Read quotes
     for (size_t i = 0; i < quoteCount; ++i) {
         if (!std::getline(file, line))
-            throw std::runtime_error("Failed to read quote line " + std::to_string(i));    
-        quotes.push_back({.quote = line, .quoteIndex = i});
+            throw std::runtime_error("Failed to read quote line " + std::to_string(i));
+        lines.push_back(line);
     }
-    if (captions.size() != captionCount)
-        throw std::runtime_error("Caption count does no match");
-    
-    // Generate random seed
-    std::srand(static_cast<unsigned int>(std::time(nullptr)));
+
+    // Build the string table
+    Header header;
+    std::memcpy(header.magic, "CMLS", 4);
+    header.version = version;
+    header.captionCount = (std::uint32_t) captionCount;
+    header.quoteCount = (std::uint32_t) quoteCount;
+
+    std::vector<std::uint32_t> offsets;
+    std::string strings;
+    for (const std::string& string : lines) {
+        offsets.push_back((std::uint32_t) strings.size());
+        strings.append(string);
+        strings.push_back('\0');
+    }
+    offsets.push_back((std::uint32_t) strings.size());
+
+    std::string table;
+    table.append((const char*) &header, sizeof(header));
+    table.append((const char*) offsets.data(), offsets.size() * sizeof(std::uint32_t));
+    table.append(strings);
+    return table;
 }
 
-Quote LanguageModule::GetQuote(size_t index) const { return quotes.at(index); }
+Quote LanguageModule::GetQuote(size_t index) const {
+    if (index >= header->quoteCount)
+        throw std::out_of_range("Quote index out of range!");
+    return { String(header->captionCount + index), index };
+}
 
 Quote LanguageModule::GetRandomQuote() const {
-    if (quotes.empty())
+    if (header->quoteCount == 0)
         throw std::runtime_error("No quotes available!");
-    
-    return GetQuote(std::rand() % quotes.size());
+
+    return GetQuote(std::rand() % header->quoteCount);
 }
 
-std::string LanguageModule::GetTranslation(Lang::CaptionType caption) const {
+CStringView LanguageModule::GetTranslation(Lang::CaptionType caption) const {
     if (caption == Lang::NONE)
-        return " ";
-    if (caption >= captions.size())
+        return CStringView(" ", 1);
+    if (caption >= header->captionCount)
         throw std::out_of_range("Caption index out of range!");
-    return captions[caption];
+    return String(caption);
 }
 
 LanguageModule::~LanguageModule() {
     #ifdef DTOR
     std::clog << "~LanguageModule Dtor" << std::endl;
     #endif
-}
\ No newline at end of file
+}
+/* ************************************************************************************ */
+
+/***** Private Functions *****/
+LanguageModule::LanguageModule() : header(nullptr), offsets(nullptr), strings(nullptr) {
+    // Generate random seed
+    std::srand(static_cast<unsigned int>(std::time(nullptr)));
+}
+
+bool LanguageModule::Attach(std::string_view table) {
+    if (table.size() < sizeof(Header))
+        return false;
+
+    const Header* tableHeader = (const Header*) table.data();
+    if (std::memcmp(tableHeader->magic, "CMLS", 4) != 0 || tableHeader->version != version)
+        return false;
+
+    std::uint64_t count = (std::uint64_t) tableHeader->captionCount + tableHeader->quoteCount;
+    std::uint64_t indexSize = (count + 1) * sizeof(std::uint32_t);
+    if (table.size() < sizeof(Header) + indexSize)
+        return false;
+
+    // Every string has to be inside the table and null-terminated
+    const std::uint32_t* tableOffsets = (const std::uint32_t*) (table.data() + sizeof(Header));
+    const char* tableStrings = table.data() + sizeof(Header) + indexSize;
+    std::uint64_t stringsSize = table.size() - sizeof(Header) - indexSize;
+    if (tableOffsets[0] != 0 || tableOffsets[count] != stringsSize)
+        return false;
+    for (std::uint64_t i = 0; i < count; ++i)
+        if (tableOffsets[i] >= tableOffsets[i + 1] || tableStrings[tableOffsets[i + 1] - 1] != '\0')
+            return false;
+
+    header = tableHeader;
+    offsets = tableOffsets;
+    strings = tableStrings;
+    return true;
+}
+
+CStringView LanguageModule::String(size_t index) const {
+    return CStringView(strings + offsets[index], offsets[index + 1] - offsets[index] - 1);
+}
@@ -0,0 +1,67 @@
+/** @file LatencyProbe.cpp
+  * @brief Contains the implementation of LatencyProbe.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
+
+#include "LatencyProbe.h"
+
+void LatencyProbe::Tag(std::uint32_t timestamp) { queued.push_back(timestamp); }
+
+void LatencyProbe::Consume(std::uint32_t now) {
+    auto handled = std::partition(queued.begin(), queued.end(), [now](std::uint32_t timestamp) { return timestamp > now; });
+    inFlight.insert(inFlight.end(), handled, queued.end());
+    queued.erase(handled, queued.end());
+}
+
+void LatencyProbe::Present(std::uint32_t now, const std::string& scene) {
+    if (inFlight.empty())
+        return;
+
+    std::vector<std::uint32_t>& latencies = samples[scene];
+    for (std::uint32_t timestamp : inFlight)
+        latencies.push_back(now - timestamp);
+    inFlight.clear();
+}
+
+size_t LatencyProbe::GetSampleCount(const std::string& scene) const {
+    auto found = samples.find(scene);
+    return found == samples.end() ? 0 : found->second.size();
+}
+
+std::uint32_t LatencyProbe::GetPercentile(const std::string& scene, double percent) const {
+    auto found = samples.find(scene);
+    if (found == samples.end() || found->second.empty())
+        return 0;
+
+    std::vector<std::uint32_t> sorted = found->second;
+    size_t rank = (size_t) std::ceil(percent / 100.0 * sorted.size());
+    size_t index = rank == 0 ? 0 : std::min(rank, sorted.size()) - 1;
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    return sorted[index];
+}
+
+void LatencyProbe::Report(std::ostream& os) const {
+    os << "***** Input-to-photon latency (ms) *****" << std::endl;
+    for (const auto& scene : samples) {
+        os << scene.first << ": " << scene.second.size() << " events"
+           << ", p50 " << GetPercentile(scene.first, 50)
+           << ", p95 " << GetPercentile(scene.first, 95)
+           << ", p99 " << GetPercentile(scene.first, 99)
+           << ", max " << GetPercentile(scene.first, 100) << std::endl;
+    }
+}
+
+LatencyProbe::~LatencyProbe() {
+    #ifdef DTOR
+    std::clog << "~LatencyProbe Dtor" << std::endl;
+    #endif
+}
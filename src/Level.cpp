@@ -15,6 +15,11 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <random>
+#include <algorithm>
 
 #include "Level.h"
 #include "GameObject.h"
@@ -24,70 +29,191 @@
 #include "Block.h"
 #include "LevelElement.h"
 #include "RenderWindow.h"
-
-bool Level::isCompleted = false;
-
-Level::Level(std::string configFile, RenderWindow* window, int frameDelay)
-    : player(nullptr), grid(SCALED_BLOCK_SIZE), animation("../res/img/Coin.png",
-        (float) frameDelay / 1000.0f), enemyWithQuote(nullptr)
+#include "Assets.h"
+#include "World.h"
+#include "Components.h"
+#include "Arena.h"
+#include "AllocTracker.h"
+
+int Level::textureUsers = 0;
+const size_t Level::arenaSize = 256 * 1024;
+std::mutex Level::textureMutex;
+
+Level::Level(std::string configFile, RenderWindow* window)
+    : arena(arenaSize), player(nullptr), grid(SCALED_BLOCK_SIZE), coyoteTime(0.0f), enemyWithQuote(nullptr), random(std::random_device()()),
+        nextActivation(0)
     {
-    GameObject::window = window;
-    GameObject::screen = {0, 0, window->GetWidth(), window->GetHeight()};
-    isCompleted = false;
-
-    Block::textures = Texture::LoadStaticTexture("../res/img/Block.png");
-    Entity::textures = Texture::LoadStaticTexture("../res/img/Entity.png");
-    LevelElement::textures = Texture::LoadStaticTexture("../res/img/LevelElement.png");
+    Bind();
+    events.reserve(32);
+    if (window != nullptr) {
+        GameObject::window = window;
+        world.screen = {0, 0, window->GetWidth(), window->GetHeight()};
+    }
 
+    AcquireTextures();
     LoadLevelFromConfigFile(configFile);
+    BuildActivationQueue();
 }
 
 void Level::Update(float dt) {
+    Bind();
+    world.exactTime += dt;
+    world.time = (Uint32) world.exactTime;
     player->Update(dt);
+    ActivateObjects();
     
-    for (auto& enemy : enemies)
-        enemy->Update(dt);
-    for (auto& enemy : tempEnemies)
-        enemy->Update(dt);
+    // A single pass over the components of the active enemies
+    CollectEnemyIds();
+    Enemy::UpdateAll(world.components, enemyIds, dt);
 
     grid.Update(dt);
     
-    for (auto& element : elements)
-        element->Update(dt);
+    for (size_t i : activeElements)
+        elements[i]->Update(dt);
 
-    if (GameObject::screen.x + GameObject::screen.w > maxCameraX)
-        GameObject::screen.x = maxCameraX - GameObject::screen.w;
+    if (world.screen.x + world.screen.w > maxCameraX)
+        world.screen.x = maxCameraX - world.screen.w;
     if (player->HitBox().x + player->HitBox().w > maxCameraX - 5) {
         player->HitBox().x = maxCameraX - player->HitBox().w - 5;
         player->GetRigidBody().ApplyVelocityX(0.0f);
     }
-    else if (GameObject::screen.x + (GameObject::screen.w / 2) < player->HitBox().x + player->HitBox().w && GameObject::screen.x + GameObject::screen.w < maxCameraX)
-        GameObject::screen.x = player->HitBox().x + player->HitBox().w - (GameObject::screen.w / 2);
+    else if (world.screen.x + (world.screen.w / 2) < player->HitBox().x + player->HitBox().w && world.screen.x + world.screen.w < maxCameraX)
+        world.screen.x = player->HitBox().x + player->HitBox().w - (world.screen.w / 2);
+}
+
+void Level::HandleInput(const PlayerInput& input, float dt) {
+    Bind();
+    if (player->IsDead() || player->isForcedByFlag)
+        return;
+    // Up (pressing down at the same time cancels the jump, and it is allowed shortly after leaving the ground)
+    bool canJump = player->onGround || (player->hasJumped == false && player->airTime < coyoteTime);
+    if (input.up && input.down == false && player->jumpTime.IsActive() == false && canJump && player->jump == false) {
+        player->GetRigidBody().ApplyForceY(-5.5f * RigidBody::gravity);
+        player->jumpTime.Activate(100);
+        player->jump = true;
+        player->hasJumped = true;   // The coyote time is used up until the player lands
+        #ifdef COLLISION
+        std::clog << "Activate Jump Time!" << std::endl;
+        #endif
+        AddEvent(LevelEvent::JUMP, player->HitBox().x, player->HitBox().y);
+    }
+    // Released (after jumping, so a press shorter than an update cycle makes a short jump)
+    if (input.upReleased)
+        player->jump = false;
+    // Handle Jump
+    if (player->jumpTime.GetPercent() > 0.5f && player->jumpTime.IsActive()) {
+        // Long Jump
+        if (player->jump) {
+            player->GetRigidBody().ApplyForceY(-4.0f * RigidBody::gravity);
+            player->jumpTime.Activate(100);
+            player->jump = false;
+            #ifdef COLLISION
+            std::clog << "Long Jump!" << std::endl;
+            #endif
+        }
+        // Stop Jumping
+        else {
+            player->GetRigidBody().ApplyForceY(0.0f);
+            player->jumpTime.Deactivate();
+            #ifdef COLLISION
+            std::clog << "Deactivate Jump!" << std::endl;
+            #endif
+        }
+    }
+
+    // Horizontally Still
+    if (input.right == input.left) {
+        player->GetRigidBody().ApplyForceX(0.0f);
+    }
+    // Right
+    else if (input.right) {
+        player->GetRigidBody().ApplyForceX(2.0f);
+        player->GetFlags().faceLeft = false;
+        player->runTime += dt / 1000.0f;
+    }
+    // Left
+    else {
+        player->GetRigidBody().ApplyForceX(-2.0f);
+        player->GetFlags().faceLeft = true;
+        player->runTime += dt / 1000.0f;
+    }
+    if (player->runTime > 0.08f) {
+        player->runSprite = !player->runSprite;
+        player->runTime = 0.0f;
+    }
+}
+
+void Level::Simulate(const PlayerInput& input, float dt) {
+    ALLOC_SCOPE("Level::Simulate");
+    Update(dt);
+
+    CheckForDeath();
+
+    CheckForCollision(input);
+
+    CheckForAnimation();
+
+    RecoverPosition(); // if necessary
+
+    // Landing (after being in the air) allows the coyote time again
+    if (player->onGround && player->airTime > 0.0f)
+        player->hasJumped = false;
+    player->airTime = player->onGround ? 0.0f : player->airTime + dt;
+}
+
+void Level::Step(const PlayerInput& input, float dt) {
+    events.clear();
+    HandleInput(input, dt);
+    if (player->IsDead() == false)
+        Simulate(input, dt);
 }
 
+void Level::UpdateParticles(float dt) {
+    for (size_t i : activeElements)
+        if (Laser* laser = dynamic_cast<Laser*>(elements[i].get()))
+            if (laser->GetFlags().isRemoved == false)
+                particles.EmitTrail(laser->IsFacingLeft() ? laser->HitBox().x + laser->HitBox().w : laser->HitBox().x,
+                    laser->HitBox().y + laser->HitBox().h / 2);
+
+    particles.Update(dt);
+}
+
+void Level::SetCoyoteTime(float milliSeconds) { coyoteTime = milliSeconds; }
+
+void Level::SetSeed(unsigned int seed) { random.seed(seed); }
+
+std::unique_ptr<Level> Level::Clone() const { return std::unique_ptr<Level>(new Level(*this)); }
+
+std::vector<LevelEvent>& Level::GetEvents() { return events; }
+
+Player& Level::GetPlayer() { return *player; }
+
 void Level::Render() {
+    ALLOC_SCOPE("Level::Render");
+    Bind();
     GameObject::window->DrawBackground();
 
-    for (auto& element : elements)
-        element->Render();
+    for (size_t i : activeElements)
+        elements[i]->Render();
 
-    animation.Render(GameObject::screen.x, GameObject::window->GetRenderer());
+    particles.Render(world.screen.x, GameObject::window->GetRenderer());
 
     grid.Render();
 
-    for (auto& enemy : enemies)
-        enemy->Render();
+    for (size_t i : activeEnemies)
+        enemies[i]->Render();
     for (auto& enemy: tempEnemies)
         enemy->Render();
 
-    if (quoteButton != nullptr)
+    if (quoteButton != nullptr && enemyWithQuote != nullptr)
         quoteButton->DrawButton();
 
     player->Render();
 }
 
 void Level::Reset() {
-    GameObject::screen.x = 0;
+    Bind();
+    world.screen.x = 0;
     player->Reset();
     
     for (auto& enemy : enemies)
@@ -99,20 +225,129 @@ void Level::Reset() {
         element->Reset();
 
     enemyWithQuote = nullptr;
-    quoteButton.reset();
+    particles.Clear();
 
-    // Delete temporary Enemies that are spawned by Mystery Blocks
+    // Put temporary Enemies that are spawned by Mystery Blocks back to their pools
+    for (auto& enemy : tempEnemies)
+        enemyPools[enemy->GetType()].push_back(std::move(enemy));
     tempEnemies.clear();
 
+    BuildActivationQueue();
+
     if (player->HitBox().x > 500)
-        GameObject::screen.x = player->HitBox().x - 300;
+        world.screen.x = player->HitBox().x - 300;
 }
 
-Level::~Level() {
-    if (Entity::textures != nullptr) {
-        SDL_DestroyTexture(Entity::textures);
-        Entity::textures = nullptr;
+/**
+ * @brief Pairs up the objects of the new config with the unchanged objects of the old config.
+ * @param oldObjects Objects of the currently loaded config.
+ * @param newObjects Objects of the reloaded config.
+ * @return Returns the index of the matching old object for every new object (-1 if it has changed or it is new).
+ */
+static std::vector<int> MatchObjects(const std::vector<ObjectData>& oldObjects, const std::vector<ObjectData>& newObjects) {
+    std::map<ObjectData, std::vector<int>> unused;
+    for (int i = (int) oldObjects.size() - 1; i >= 0; --i)
+        unused[oldObjects[i]].push_back(i);
+
+    std::vector<int> matches;
+    matches.reserve(newObjects.size());
+    for (auto& object : newObjects) {
+        auto it = unused.find(object);
+        if (it == unused.end() || it->second.empty())
+            matches.push_back(-1);
+        else {
+            matches.push_back(it->second.back());
+            it->second.pop_back();
+        }
+    }
+    return matches;
+}
+
+bool Level::Reload() {
+    Bind();
+    LevelDefinition newDefinition;
+    try {
+        if (!ReadConfigFile(configFile, newDefinition)) {
+            std::cerr << "Failed to open config file: " << configFile << std::endl;
+            return false;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Failed to reload level: " << e.what() << std::endl;
+        return false;
+    }
+
+    int changedBlocks = 0, changedEnemies = 0, changedElements = 0;
+
+    // Grid: a resized grid is rebuilt, otherwise only the changed cells are replaced
+    bool isResized = newDefinition.gridSize.x != definition->gridSize.x || newDefinition.gridSize.y != definition->gridSize.y;
+    if (isResized) {
+        grid.InitGrid(newDefinition.gridSize.x, newDefinition.gridSize.y);
+        maxCameraX = newDefinition.gridSize.x * SCALED_BLOCK_SIZE - 1;
+    }
+    for (int i = 0; i < (int) newDefinition.cells.size(); ++i) {
+        BlockType::Type oldCell = isResized ? BlockType::NONE : definition->cells[i];
+        if (newDefinition.cells[i] != oldCell) {
+            AddBlock(newDefinition.cells[i], i / newDefinition.gridSize.x, i % newDefinition.gridSize.x);
+            ++changedBlocks;
+        }
+    }
+    grid.UpdateDestRect();
+
+    // Enemies: unchanged ones are kept with their current state, the rest are respawned
+    std::vector<int> matches = MatchObjects(definition->enemies, newDefinition.enemies);
+    std::vector<std::unique_ptr<Enemy>> oldEnemies;
+    oldEnemies.swap(enemies);
+    enemies.reserve(newDefinition.enemies.size());
+    for (int i = 0; i < (int) matches.size(); ++i) {
+        if (matches[i] >= 0)
+            enemies.push_back(std::move(oldEnemies[matches[i]]));
+        else {
+            AddEnemy(newDefinition.enemies[i]);
+            enemies.back()->UpdateDestRect();
+            ++changedEnemies;
+        }
     }
+    for (auto& enemy : oldEnemies) {
+        if (enemy != nullptr && enemy.get() == enemyWithQuote) {
+            enemyWithQuote = nullptr;
+        }
+    }
+
+    // Level elements
+    matches = MatchObjects(definition->elements, newDefinition.elements);
+    std::vector<std::unique_ptr<LevelElement>> oldElements;
+    oldElements.swap(elements);
+    elements.reserve(newDefinition.elements.size());
+    for (int i = 0; i < (int) matches.size(); ++i) {
+        if (matches[i] >= 0)
+            elements.push_back(std::move(oldElements[matches[i]]));
+        else {
+            AddElement(newDefinition.elements[i]);
+            elements.back()->UpdateDestRect();
+            ++changedElements;
+        }
+    }
+
+    // The player keeps its position, only the spawn point is moved
+    player->SpawnPoint().x = newDefinition.player.x;
+    player->SpawnPoint().y = newDefinition.player.y;
+
+    definition = std::make_shared<const LevelDefinition>(std::move(newDefinition));
+    BuildActivationQueue();
+
+    std::clog << "Reloaded level: " << changedBlocks << " block(s), " << changedEnemies << " enemy(s), "
+        << changedElements << " element(s) changed" << std::endl;
+    return true;
+}
+
+const std::string& Level::GetConfigFile() const { return configFile; }
+
+World& Level::GetWorld() { return world; }
+
+Level::~Level() {
+    World::Unbind(world);
+    Arena::Unbind(&arena);
+    ReleaseTextures();
     #ifdef DTOR
     std::clog << "~Level Dtor" << std::endl;
     #endif
@@ -120,6 +355,323 @@ Level::~Level() {
 /* ************************************************************************************ */
 
 /***** Private Functions *****/
+Level::Level(const Level& other)
+    : arena(other.arena.GetUsed() + 1024), world(other.world), player(nullptr), grid(other.grid.blockSize),
+    coyoteTime(other.coyoteTime), quote(other.quote),
+    enemyWithQuote(nullptr), maxCameraX(other.maxCameraX), configFile(other.configFile),
+    definition(other.definition), random(other.random), events(other.events), activationQueue(other.activationQueue),
+    nextActivation(other.nextActivation), activeEnemies(other.activeEnemies), activeElements(other.activeElements),
+    enemyIds(other.enemyIds), visibleIds(other.visibleIds)
+    {
+    // The clones are allocated from the arena of the new level, and refer to the copied components of its world
+    // (the arena and the world of the caller are bound again afterwards)
+    Arena* previousArena = Arena::Current();
+    World& previousWorld = World::Current();
+    Arena::Bind(&arena);
+    World::Bind(world);
+
+    player = std::make_unique<Player>(*other.player);
+    grid = other.grid;
+    enemies.reserve(other.enemies.size());
+    for (auto& enemy : other.enemies)
+        enemies.push_back(enemy->Clone());
+    tempEnemies.reserve(other.tempEnemies.size());
+    for (auto& enemy : other.tempEnemies)
+        tempEnemies.push_back(enemy->Clone());
+    elements.reserve(other.elements.size());
+    for (auto& element : other.elements)
+        elements.push_back(element->Clone());
+
+    Arena::Bind(previousArena);
+    World::Bind(previousWorld);
+    AcquireTextures();
+}
+
+void Level::Bind() {
+    World::Bind(world);
+    Arena::Bind(&arena);
+}
+
+void Level::CheckForDeath() {
+    // Player leaves screen
+    if (GameObject::AABB(player->HitBox(), world.screen) == false && player->HitBox().y + player->HitBox().h > 5) {
+        player->Kill();
+        // std::clog << "Player left the screen!" << std::endl;
+    }
+    // Enemy leaves screen
+    for (size_t i : activeEnemies)
+        if(enemies[i]->IsDead() == false && GameObject::AABB(enemies[i]->HitBox(), world.screen) == false && enemies[i]->HitBox().x < world.screen.x + world.screen.w)
+            enemies[i]->Kill();
+    for (auto& enemy : tempEnemies)
+        if(enemy->IsDead() == false && GameObject::AABB(enemy->HitBox(), world.screen) == false && enemy->HitBox().x < world.screen.x + world.screen.w)
+            enemy->Kill();
+    // Level Element leaves screen
+    for (size_t i : activeElements)
+        if (elements[i]->GetFlags().isRemoved == false && GameObject::AABB(elements[i]->HitBox(), world.screen) == false && elements[i]->HitBox().x < world.screen.x + world.screen.w)
+            elements[i]->GetFlags().isRemoved = true;
+}
+
+void Level::CheckForCollision(const PlayerInput& input) {
+    // Player <==> Blocks
+    if (player->IsDead() == false && player->isGiga == false)
+        grid.CheckCollision(player.get());
+
+    // Enemies <==> Blocks
+    for (size_t i : activeEnemies)
+        if (enemies[i]->IsDead() == false)
+            grid.CheckCollision(enemies[i].get());
+    
+    for (auto& enemy : tempEnemies)
+        if (enemy->IsDead() == false)
+            grid.CheckCollision(enemy.get());
+
+    // Player <==> Enemies
+    for (size_t i : activeEnemies)
+        if (enemies[i]->IsDead() == false && GameObject::AABB(player->HitBox(), enemies[i]->HitBox()))
+            player->Touch(enemies[i].get());
+
+    for (auto& enemy : tempEnemies)
+        if (enemy->IsDead() == false && GameObject::AABB(player->HitBox(), enemy->HitBox()))
+            player->Touch(enemy.get());
+
+    // Enemies <==> Enemies
+    for (size_t i : activeEnemies)
+        for (size_t j : activeEnemies)
+            if (i != j && enemies[i]->IsDead() == false && enemies[j]->IsDead() == false)
+                if (GameObject::AABB(enemies[i]->HitBox(), enemies[j]->HitBox()))
+                    enemies[i]->Touch(enemies[j].get());
+    
+    for (size_t i : activeEnemies)
+        for (auto& other : tempEnemies)
+            if (enemies[i]->IsDead() == false && other->IsDead() == false)
+                if (GameObject::AABB(enemies[i]->HitBox(), other->HitBox())) {
+                    enemies[i]->Touch(other.get());
+                    other->Touch(enemies[i].get());  // necessary for handling all interactions
+                }
+
+    for (auto& enemy : tempEnemies)
+        for (auto& other : tempEnemies)
+            if (enemy != other && enemy->IsDead() == false && other->IsDead() == false)
+                if (GameObject::AABB(enemy->HitBox(), other->HitBox()))
+                    enemy->Touch(other.get());
+    
+    // Player <==> Elements
+    for (size_t i : activeElements)
+        if (GameObject::AABB(player->HitBox(), elements[i]->HitBox()) && player->IsDead() == false)
+            player->Touch(elements[i].get());
+
+    // Enemies <==> Elements
+    for (size_t i : activeEnemies)
+        for (size_t j : activeElements)
+            if (enemies[i]->IsDead() == false && elements[j]->GetFlags().isRemoved == false)
+                if (GameObject::AABB(enemies[i]->HitBox(), elements[j]->HitBox()))
+                    enemies[i]->Touch(elements[j].get());
+
+    for (auto& enemy : tempEnemies)
+        for (size_t j : activeElements)
+            if (enemy->IsDead() == false && elements[j]->GetFlags().isRemoved == false)
+                if (GameObject::AABB(enemy->HitBox(), elements[j]->HitBox()))
+                    enemy->Touch(elements[j].get());
+
+    if (player->HasCollided() == false && player->jump == false && player->jumpTime.IsActive() == false)
+        player->GetRigidBody().ApplyForceY(0.0f);
+    if (player->onGround && input.right == input.left && player->isForcedByFlag == false)
+        player->GetRigidBody().ScaleVelocity(Fixed(9) / Fixed(10));
+}
+
+void Level::CheckForAnimation() {
+    // Block Sounds and Animations
+    int startColumn = world.screen.x / grid.blockSize;
+    int endColumn = (world.screen.x + world.screen.w) / grid.blockSize + 1;
+    if (startColumn < 0) startColumn = 0;
+    if (endColumn > grid.width) endColumn = grid.width;
+
+    for (int row=0; row < grid.height; ++row) {
+        for (int column=startColumn; column < endColumn; ++column) {
+            // Only the flags are checked, the type of the block is only looked up when it wants an animation
+            Block* block = grid.blocks.at(row * grid.width + column).get();
+            if (block == nullptr || block->GetFlags().playSound == false)
+                continue;
+            block->GetFlags().playSound = false;
+
+            // Hidden Block
+            if (dynamic_cast<HiddenBlock*>(block)) {
+                AddEvent(LevelEvent::COIN, block->HitBox().x + (block->HitBox().w / 2), block->HitBox().y);
+
+                // Limit Player's speed for pleasant memories
+                player->GetRigidBody().ApplyVelocityX(0.0f);
+            }
+            // Brick Block
+            else if (dynamic_cast<BrickBlock*>(block))
+                AddEvent(LevelEvent::BREAK, block->HitBox().x, block->HitBox().y);
+            // Mystery Block
+            else if (dynamic_cast<MysteryBlock*>(block)) {
+                // Add Coin or Spawn Random Enemy (the first rolls are the types of the enemies)
+                unsigned roll = random() % 10;
+                if (roll < EnemyType::COUNT) {
+                    EnemyType::Type type = (EnemyType::Type) roll;
+                    SpawnEnemy(type, block->HitBox().x, block->HitBox().y - Enemy::archetypes[type].spawnHeight);
+                }
+                else
+                    AddEvent(LevelEvent::COIN, block->HitBox().x + (block->HitBox().w / 2), block->HitBox().y);
+            }
+        }
+    }
+
+    // Check for Roar Sound
+    if (player->GetFlags().playSound && player->isGiga) {
+        player->GetFlags().playSound = false;
+        AddEvent(LevelEvent::ROAR, player->HitBox().x, player->HitBox().y);
+    }
+    // Check for Enemy Sounds
+    for (size_t i : activeEnemies) {
+        if (enemies[i]->GetFlags().playSound) {
+            enemies[i]->GetFlags().playSound = false;
+            AddEvent(LevelEvent::POP, enemies[i]->HitBox().x, enemies[i]->HitBox().y);
+        }
+    }
+    for (auto& enemy : tempEnemies) {
+        if (enemy->GetFlags().playSound) {
+            enemy->GetFlags().playSound = false;
+            AddEvent(LevelEvent::POP, enemy->HitBox().x, enemy->HitBox().y);
+        }
+    }
+    // Check for Element Sounds
+    for (size_t i : activeElements) {
+        auto& element = elements[i];
+        if (element->GetFlags().playSound) {
+            element->GetFlags().playSound = false;
+            if (dynamic_cast<Fish*>(element.get()))
+                AddEvent(LevelEvent::FISH, element->HitBox().x, element->HitBox().y);
+            else if (dynamic_cast<Laser*>(element.get()))
+                AddEvent(LevelEvent::LASER, element->HitBox().x, element->HitBox().y);
+            else if (dynamic_cast<EndFlag*>(element.get()))
+                AddEvent(LevelEvent::FLAG, element->HitBox().x, element->HitBox().y);
+            else
+                throw "Unknown Level Element!";
+        }
+    }
+}
+
+void Level::RecoverPosition() {
+    if (player->recoverX)
+        player->HitBox().x = player->PreviousPosition().x;
+    if (player->recoverY)
+        player->HitBox().y = player->PreviousPosition().y;
+}
+
+void Level::BuildActivationQueue() {
+    activationQueue.clear();
+    nextActivation = 0;
+    activeEnemies.clear();
+    activeElements.clear();
+    // Every object can be active at the same time, so activating them never allocates
+    activeEnemies.reserve(enemies.size());
+    activeElements.reserve(elements.size());
+    enemyIds.reserve(enemies.size());
+    visibleIds.reserve(grid.height * (world.screen.w / grid.blockSize + 3) + elements.size() + enemies.size() + 1);
+
+    for (size_t i = 0; i < enemies.size(); ++i) {
+        if (enemies[i]->IsDead())
+            continue;
+        if (enemies[i]->GetFlags().isActivated)
+            activeEnemies.push_back(i);
+        else
+            activationQueue.push_back({enemies[i]->GetActivationPoint(), true, i});
+    }
+    for (size_t i = 0; i < elements.size(); ++i) {
+        if (elements[i]->GetFlags().isRemoved)
+            continue;
+        if (elements[i]->GetFlags().isActivated)
+            activeElements.push_back(i);
+        else
+            activationQueue.push_back({elements[i]->GetActivationPoint(), false, i});
+    }
+
+    // Objects with the same activation point keep the order of the config file
+    std::stable_sort(activationQueue.begin(), activationQueue.end(), [](const Activation& lhs, const Activation& rhs) {
+        return lhs.position < rhs.position;
+    });
+}
+
+void Level::ActivateObjects() {
+    // Objects removed in the previous update cycle are dropped from the active sets
+    activeEnemies.erase(std::remove_if(activeEnemies.begin(), activeEnemies.end(),
+        [this](size_t i) { return enemies[i]->IsDead(); }), activeEnemies.end());
+    activeElements.erase(std::remove_if(activeElements.begin(), activeElements.end(),
+        [this](size_t i) { return elements[i]->GetFlags().isRemoved; }), activeElements.end());
+
+    // The active sets are kept in the order of the containers, so the collisions are handled in the same order
+    while (nextActivation < activationQueue.size() && activationQueue[nextActivation].position <= world.playerPosition) {
+        const Activation& activation = activationQueue[nextActivation++];
+        if (activation.isEnemy) {
+            enemies[activation.index]->Activate();
+            activeEnemies.insert(std::upper_bound(activeEnemies.begin(), activeEnemies.end(), activation.index), activation.index);
+        }
+        else {
+            elements[activation.index]->Activate();
+            activeElements.insert(std::upper_bound(activeElements.begin(), activeElements.end(), activation.index), activation.index);
+        }
+    }
+}
+
+void Level::CollectEnemyIds() {
+    enemyIds.clear();
+    for (size_t i : activeEnemies)
+        enemyIds.push_back(enemies[i]->id);
+    for (auto& enemy : tempEnemies)
+        enemyIds.push_back(enemy->id);
+}
+
+void Level::CollectVisibleIds() {
+    visibleIds.clear();
+    int startColumn = world.screen.x / grid.blockSize - 1;
+    int endColumn = (world.screen.x + world.screen.w) / grid.blockSize + 2;
+    if (startColumn < 0) startColumn = 0;
+    if (endColumn > grid.width) endColumn = grid.width;
+
+    for (int row = 0; row < grid.height; ++row)
+        for (int column = startColumn; column < endColumn; ++column)
+            if (grid.blocks[row * grid.width + column] != nullptr)
+                visibleIds.push_back(grid.blocks[row * grid.width + column]->GetId());
+    for (size_t i : activeElements)
+        visibleIds.push_back(elements[i]->id);
+    visibleIds.push_back(player->id);
+    visibleIds.insert(visibleIds.end(), enemyIds.begin(), enemyIds.end());
+}
+
+void Level::AddEvent(LevelEvent::Type type, int x, int y) { events.push_back({type, x, y}); }
+
+void Level::AcquireTextures() {
+    // Headless levels (no renderer) do not need textures
+    if (Texture::renderer == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(textureMutex);
+    if (textureUsers++ > 0)
+        return;
+
+    Block::textures = Texture::LoadStaticTexture("img/Block.png");
+    Entity::textures = Texture::LoadStaticTexture("img/Entity.png");
+    LevelElement::textures = Texture::LoadStaticTexture("img/LevelElement.png");
+}
+
+void Level::ReleaseTextures() {
+    if (Texture::renderer == nullptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(textureMutex);
+    if (textureUsers == 0 || --textureUsers > 0)
+        return;
+
+    for (SDL_Texture** textures : { &Entity::textures, &Block::textures, &LevelElement::textures }) {
+        if (*textures != nullptr) {
+            SDL_DestroyTexture(*textures);
+            *textures = nullptr;
+        }
+    }
+}
+
 void Level::AddPlayer(int x, int y) {
     SDL_Rect srcRect = {0, 0, 24, 34};
     SDL_Rect hitBox = {x, y, 60, 85};
@@ -169,34 +721,36 @@ void Level::AddMysteryBlock(int row, int column) {
     grid(row, column) = std::make_unique<MysteryBlock>(hitBox, srcRect, hitBox);
 }
 
-void Level::AddCommonEnemy(int x, int y, int activationPoint, bool faceLeft) {
-    SDL_Rect hitBox = {x, y, 75, 68};
-    SDL_Rect srcRect = {0, 68, 30, 27};
-    enemies.push_back(std::make_unique<CommonEnemy>(hitBox, activationPoint, srcRect, 30, hitBox, faceLeft));
-}
-
-void Level::AddSoldierEnemy(int x, int y, int activationPoint, bool faceLeft) {
-    SDL_Rect hitBox = {x, y, 75, 92};
-    SDL_Rect srcRect = {0, 95, 30, 38};
-    enemies.push_back(std::make_unique<SoldierEnemy>(hitBox, activationPoint, srcRect, 30, hitBox, faceLeft));
+void Level::AddEnemy(EnemyType::Type type, int x, int y, int activationPoint, bool faceLeft) {
+    enemies.push_back(Enemy::Create(type, x, y, activationPoint, faceLeft));
 }
 
-void Level::AddKingEnemy(int x, int y, int activationPoint, bool faceLeft) {
-    SDL_Rect hitBox = {x, y, 80, 82};
-    SDL_Rect srcRect = {60, 68, 32, 33};
-    enemies.push_back(std::make_unique<KingEnemy>(hitBox, activationPoint, srcRect, 32, hitBox, faceLeft));
-}
-
-void Level::AddRedMushroomEnemy(int x, int y, int activationPoint, bool faceLeft) {
-    SDL_Rect hitBox = {x, y, 73, 73};
-    SDL_Rect srcRect = {62, 131, 29, 29};
-    enemies.push_back(std::make_unique<RedMushroomEnemy>(hitBox, activationPoint, srcRect, 29, hitBox, faceLeft));
-}
+void Level::SpawnEnemy(EnemyType::Type type, int x, int y) {
+    std::vector<std::unique_ptr<Enemy>>& pool = enemyPools[type];
+
+    // Take back a removed enemy of the same type (the others keep their order, so they interact the same way)
+    if (pool.empty()) {
+        for (auto it = tempEnemies.begin(); it != tempEnemies.end(); ++it) {
+            if ((*it)->IsDead() && (*it)->GetType() == type) {
+                if (it->get() == enemyWithQuote) {
+                    enemyWithQuote = nullptr;
+                }
+                pool.push_back(std::move(*it));
+                tempEnemies.erase(it);
+                break;
+            }
+        }
+    }
 
-void Level::AddPurpleMushroomEnemy(int x, int y, int activationPoint, bool faceLeft) {
-    SDL_Rect hitBox = {x, y, 73, 75};
-    SDL_Rect srcRect = {63, 101, 29, 30};
-    enemies.push_back(std::make_unique<PurpleMushroomEnemy>(hitBox, activationPoint, srcRect, 29, hitBox, faceLeft));
+    if (pool.empty())
+        tempEnemies.push_back(Enemy::Create(type, x, y, 0, false));
+    else {
+        pool.back()->Respawn(x, y, 0, false);
+        tempEnemies.push_back(std::move(pool.back()));
+        pool.pop_back();
+    }
+    // Spawned enemies have no activation point
+    tempEnemies.back()->Activate();
 }
 
 void Level::AddHill(int x, int y) {
@@ -275,190 +829,158 @@ void Level::AddHouse(int x, int y) {
 /* ************************************************************************************ */
 
 /***** Level Config Functions *****/
+void Level::AddBlock(BlockType::Type type, int row, int column) {
+    switch (type) {
+        case BlockType::UPPER_DIRT: AddUpperDirtBlock(row, column); break;
+        case BlockType::LOWER_DIRT: AddLowerDirtBlock(row, column); break;
+        case BlockType::BRICK:      AddBrickBlock(row, column);     break;
+        case BlockType::BOXY:       AddBoxyBlock(row, column);      break;
+        case BlockType::HIDDEN:     AddHiddenBlock(row, column);    break;
+        case BlockType::MYSTERY:    AddMysteryBlock(row, column);   break;
+        default: grid(row, column).reset();
+    }
+}
+
+void Level::AddEnemy(const ObjectData& object) {
+    const EnemyData& data = object.data;
+    EnemyType::Type type = Enemy::FindType(object.type);
+    if (type != EnemyType::COUNT)
+        AddEnemy(type, data.spawnPoint.x, data.spawnPoint.y, data.activationPoint, data.faceLeft);
+}
+
+void Level::AddElement(const ObjectData& object) {
+    const EnemyData& data = object.data;
+    if (object.type == "Hill")
+        AddHill(data.spawnPoint.x, data.spawnPoint.y);
+    else if (object.type == "Tree")
+        AddTree(data.spawnPoint.x, data.spawnPoint.y);
+    else if (object.type == "Grass")
+        AddGrass(data.spawnPoint.x, data.spawnPoint.y);
+    else if (object.type == "Cloud")
+        AddCloud(data.spawnPoint.x, data.spawnPoint.y);
+    else if (object.type == "Fish")
+        AddFish(data.spawnPoint.x, data.spawnPoint.y, data.activationPoint, data.faceLeft);
+    else if (object.type == "Laser")
+        AddLaser(data.spawnPoint.x, data.spawnPoint.y, data.activationPoint, data.faceLeft);
+    else if (object.type == "HighTube")
+        AddHighTube(data.spawnPoint.x, data.spawnPoint.y);
+    else if (object.type == "MiddleTube")
+        AddMiddleTube(data.spawnPoint.x, data.spawnPoint.y);
+    else if (object.type == "LowTube")
+        AddLowTube(data.spawnPoint.x, data.spawnPoint.y);
+    else if (object.type == "CheckpointFlag")
+        AddCheckpointFlag(data.spawnPoint.x, data.spawnPoint.y);
+    else if (object.type == "EndFlag")
+        AddEndFlag(data.spawnPoint.x, data.spawnPoint.y);
+    else if (object.type == "House")
+        AddHouse(data.spawnPoint.x, data.spawnPoint.y);
+}
+
 void Level::LoadLevelFromConfigFile(std::string configFile) {
-    std::ifstream in(configFile);
-    if (!in.is_open()) {
+    this->configFile = configFile;
+    std::shared_ptr<LevelDefinition> loaded = std::make_shared<LevelDefinition>();
+    if (!ReadConfigFile(configFile, *loaded)) {
         std::cerr << "Failed to open config file: " << configFile << std::endl;
         return;
     }
+    definition = loaded;
+
+    grid.InitGrid(definition->gridSize.x, definition->gridSize.y);
+    maxCameraX = definition->gridSize.x * SCALED_BLOCK_SIZE - 1;
+
+    AddPlayer(definition->player.x, definition->player.y);
+
+    for (int i = 0; i < (int) definition->cells.size(); ++i)
+        if (definition->cells[i] != BlockType::NONE)
+            AddBlock(definition->cells[i], i / definition->gridSize.x, i % definition->gridSize.x);
+
+    for (auto& enemy : definition->enemies)
+        AddEnemy(enemy);
+    for (auto& element : definition->elements)
+        AddElement(element);
+}
+
+bool Level::ReadConfigFile(const std::string& configFile, LevelDefinition& definition) {
+    std::unique_ptr<std::istream> file = Assets::OpenStream(configFile);
+    if (file == nullptr)
+        return false;
+    std::istream& in = *file;
+
+    definition = LevelDefinition();
+    bool hasGrid = false, hasPlayer = false;
 
     std::string line;
     while (std::getline(in, line)) {
         if (line == "Grid") {
-            Coordinate coordinate = ReadCoordinate(in);
-            grid.InitGrid(coordinate.x, coordinate.y);
-            maxCameraX = coordinate.x * SCALED_BLOCK_SIZE - 1;
+            hasGrid = true;
+            definition.gridSize = ReadCoordinate(in);
+            if (definition.gridSize.x <= 0 || definition.gridSize.y <= 0)
+                throw std::runtime_error("Invalid grid size!");
+            definition.cells.assign(definition.gridSize.x * definition.gridSize.y, BlockType::NONE);
         }
         else if (line == "Player") {
-            Coordinate coordinate = ReadCoordinate(in);
-            AddPlayer(coordinate.x, coordinate.y);
-        }
-        else if (line == "UpperDirtBlock") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                Coordinate coordinate = ReadCoordinate(in);
-                AddUpperDirtBlock(coordinate.x, coordinate.y);
-            }
-        }
-        else if (line == "LowerDirtBlock") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                Coordinate coordinate = ReadCoordinate(in);
-                AddLowerDirtBlock(coordinate.x, coordinate.y);
-            }
-        }
-        else if (line == "BrickBlock") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                Coordinate coordinate = ReadCoordinate(in);
-                AddBrickBlock(coordinate.x, coordinate.y);
-            }
-        }
-        else if (line == "BoxyBlock") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                Coordinate coordinate = ReadCoordinate(in);
-                AddBoxyBlock(coordinate.x, coordinate.y);
-            }
-        }
-        else if (line == "HiddenBlock") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                Coordinate coordinate = ReadCoordinate(in);
-                AddHiddenBlock(coordinate.x, coordinate.y);
-            }
-        }
-        else if (line == "MysteryBlock") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                Coordinate coordinate = ReadCoordinate(in);
-                AddMysteryBlock(coordinate.x, coordinate.y);
-            }
-        }
-        else if (line == "CommonEnemy") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                EnemyData data = ReadEnemyData(in);
-                AddCommonEnemy(data.spawnPoint.x, data.spawnPoint.y, data.activationPoint, data.faceLeft);
-            }
-        }
-        else if (line == "SoldierEnemy") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                EnemyData data = ReadEnemyData(in);
-                AddSoldierEnemy(data.spawnPoint.x, data.spawnPoint.y, data.activationPoint, data.faceLeft);
-            }
-        }
-        else if (line == "KingEnemy") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                EnemyData data = ReadEnemyData(in);
-                AddKingEnemy(data.spawnPoint.x, data.spawnPoint.y, data.activationPoint, data.faceLeft);
-            }
-        }
-        else if (line == "RedMushroomEnemy") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                EnemyData data = ReadEnemyData(in);
-                AddRedMushroomEnemy(data.spawnPoint.x, data.spawnPoint.y, data.activationPoint, data.faceLeft);
-            }
-        }
-        else if (line == "PurpleMushroomEnemy") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                EnemyData data = ReadEnemyData(in);
-                AddPurpleMushroomEnemy(data.spawnPoint.x, data.spawnPoint.y, data.activationPoint, data.faceLeft);
-            }
-        }
-        else if (line == "Hill") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                Coordinate coordinate = ReadCoordinate(in);
-                AddHill(coordinate.x, coordinate.y);
-            }
-        }
-        else if (line == "Tree") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                Coordinate coordinate = ReadCoordinate(in);
-                AddTree(coordinate.x, coordinate.y);
-            }
-        }
-        else if (line == "Grass") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                Coordinate coordinate = ReadCoordinate(in);
-                AddGrass(coordinate.x, coordinate.y);
-            }
-        }
-        else if (line == "Cloud") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                Coordinate coordinate = ReadCoordinate(in);
-                AddCloud(coordinate.x, coordinate.y);
-            }
-        }
-        else if (line == "Fish") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                EnemyData data = ReadEnemyData(in);
-                AddFish(data.spawnPoint.x, data.spawnPoint.y, data.activationPoint, data.faceLeft);
-            }
-        }
-        else if (line == "Laser") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                EnemyData data = ReadEnemyData(in);
-                AddLaser(data.spawnPoint.x, data.spawnPoint.y, data.activationPoint, data.faceLeft);
-            }
-        }
-        else if (line == "HighTube") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                Coordinate coordinate = ReadCoordinate(in);
-                AddHighTube(coordinate.x, coordinate.y);
-            }
-        }
-        else if (line == "MiddleTube") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                Coordinate coordinate = ReadCoordinate(in);
-                AddMiddleTube(coordinate.x, coordinate.y);
-            }
-        }
-        else if (line == "LowTube") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                Coordinate coordinate = ReadCoordinate(in);
-                AddLowTube(coordinate.x, coordinate.y);
-            }
-        }
-        else if (line == "CheckpointFlag") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                Coordinate coordinate = ReadCoordinate(in);
-                AddCheckpointFlag(coordinate.x, coordinate.y);
-            }
-        }
-        else if (line == "EndFlag") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                Coordinate coordinate = ReadCoordinate(in);
-                AddEndFlag(coordinate.x, coordinate.y);
-            }
-        }
-        else if (line == "House") {
-            int count = ReadInt(in);
-            for (int i = 0; i < count; ++i) {
-                Coordinate coordinate = ReadCoordinate(in);
-                AddHouse(coordinate.x, coordinate.y);
-            }
+            hasPlayer = true;
+            definition.player = ReadCoordinate(in);
         }
+        else if (line == "UpperDirtBlock")
+            ReadBlocks(in, definition, BlockType::UPPER_DIRT);
+        else if (line == "LowerDirtBlock")
+            ReadBlocks(in, definition, BlockType::LOWER_DIRT);
+        else if (line == "BrickBlock")
+            ReadBlocks(in, definition, BlockType::BRICK);
+        else if (line == "BoxyBlock")
+            ReadBlocks(in, definition, BlockType::BOXY);
+        else if (line == "HiddenBlock")
+            ReadBlocks(in, definition, BlockType::HIDDEN);
+        else if (line == "MysteryBlock")
+            ReadBlocks(in, definition, BlockType::MYSTERY);
+        else if (line == "CommonEnemy" || line == "SoldierEnemy" || line == "KingEnemy" || line == "RedMushroomEnemy" || line == "PurpleMushroomEnemy")
+            ReadObjects(in, definition.enemies, line, true);
+        else if (line == "Fish" || line == "Laser")
+            ReadObjects(in, definition.elements, line, true);
+        else if (line == "Hill" || line == "Tree" || line == "Grass" || line == "Cloud" || line == "HighTube" || line == "MiddleTube"
+            || line == "LowTube" || line == "CheckpointFlag" || line == "EndFlag" || line == "House")
+            ReadObjects(in, definition.elements, line, false);
         else
             std::clog << "Could not find: " << line << std::endl;
     }
 
-    in.close();
+    // An empty or half-saved file (e.g. while an editor is writing it) is not a level
+    if (hasGrid == false)
+        throw std::runtime_error("Missing Grid section!");
+    if (hasPlayer == false)
+        throw std::runtime_error("Missing Player section!");
+    return true;
+}
+
+void Level::ReadBlocks(std::istream& in, LevelDefinition& definition, BlockType::Type type) {
+    int count = ReadInt(in);
+    for (int i = 0; i < count; ++i) {
+        Coordinate coordinate = ReadCoordinate(in);
+        if (coordinate.x < 0 || coordinate.x >= definition.gridSize.y || coordinate.y < 0 || coordinate.y >= definition.gridSize.x)
+            throw std::runtime_error("Block is outside of the grid: (" + std::to_string(coordinate.x) + "," + std::to_string(coordinate.y) + ")");
+        definition.cells[coordinate.x * definition.gridSize.x + coordinate.y] = type;
+    }
+}
+
+void Level::ReadObjects(std::istream& in, std::vector<ObjectData>& objects, const std::string& type, bool hasEnemyData) {
+    int count = ReadInt(in);
+    for (int i = 0; i < count; ++i) {
+        if (hasEnemyData)
+            objects.push_back({ type, ReadEnemyData(in) });
+        else
+            objects.push_back({ type, { ReadCoordinate(in), 0, false } });
+    }
+}
+
+bool ObjectData::operator==(const ObjectData& rhs) const {
+    return type == rhs.type && data.spawnPoint.x == rhs.data.spawnPoint.x && data.spawnPoint.y == rhs.data.spawnPoint.y
+        && data.activationPoint == rhs.data.activationPoint && data.faceLeft == rhs.data.faceLeft;
+}
+
+bool ObjectData::operator<(const ObjectData& rhs) const {
+    return std::tie(type, data.spawnPoint.x, data.spawnPoint.y, data.activationPoint, data.faceLeft)
+        < std::tie(rhs.type, rhs.data.spawnPoint.x, rhs.data.spawnPoint.y, rhs.data.activationPoint, rhs.data.faceLeft);
 }
 
 bool Level::ParseBool(const std::string& token) {
@@ -469,7 +991,7 @@ bool Level::ParseBool(const std::string& token) {
     throw std::runtime_error("Invalid boolean value: '" + token + "'");
 }
 
-int Level::ReadInt(std::ifstream& in) {
+int Level::ReadInt(std::istream& in) {
     std::string line;
     while (std::getline(in, line) && line.empty());
 
@@ -480,7 +1002,7 @@ int Level::ReadInt(std::ifstream& in) {
     }
 }
 
-Coordinate Level::ReadCoordinate(std::ifstream& in) {
+Coordinate Level::ReadCoordinate(std::istream& in) {
     std::string line;
     while (std::getline(in, line) && line.empty());
 
@@ -500,7 +1022,7 @@ Coordinate Level::ReadCoordinate(std::ifstream& in) {
     }
 }
 
-EnemyData Level::ReadEnemyData(std::ifstream& in) {
+EnemyData Level::ReadEnemyData(std::istream& in) {
     std::string line;
     while (std::getline(in, line) && line.empty());
 
@@ -10,11 +10,14 @@
 #include <SDL2/SDL_image.h>
 
 #include <iostream>
+#include <memory>
+#include <limits>
 
 #include "LevelElement.h"
 #include "Texture.h"
 #include "RigidBody.h"
 #include "Entity.h"
+#include "World.h"
 #include "Level.h"
 
 SDL_Texture* LevelElement::textures = nullptr;
@@ -23,40 +26,40 @@ SDL_Texture* LevelElement::textures = nullptr;
 
 /***** Class Level Element *****/
 LevelElement::LevelElement(SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect)
-    : GameObject(hitBox, srcRect, destRect, LevelElement::textures), isActivated(false), playSound(false)
+    : GameObject(ObjectKind::ELEMENT, hitBox, srcRect, destRect, LevelElement::textures)
     {
     //
 }
 
-void LevelElement::Update(float dt) {
-    isActivated = true;
-}
+void LevelElement::Update(float dt) {}
 
 void LevelElement::Render() {
     // Dest Rect:
     #ifdef COLLISION
-    rectangleRGBA(window->GetRenderer(), texture.DestRect().x, texture.DestRect().y, texture.DestRect().x + texture.DestRect().w, texture.DestRect().y + texture.DestRect().h, 0, 255, 0, 255);
+    rectangleRGBA(window->GetRenderer(), Sprite().DestRect().x, Sprite().DestRect().y, Sprite().DestRect().x + Sprite().DestRect().w, Sprite().DestRect().y + Sprite().DestRect().h, 0, 255, 0, 255);
     #endif
     
-    if (isRemoved || isActivated == false)
+    if (GetFlags().isRemoved || GetFlags().isActivated == false)
         return;
     
-    texture.Render();
+    Sprite().Render();
 }
 
 void LevelElement::Reset() {
-    isRemoved = false;
-    isActivated = false;
-    playSound = false;
+    GetFlags().isRemoved = false;
+    GetFlags().isActivated = false;
+    GetFlags().playSound = false;
 }
 
+int LevelElement::GetActivationPoint() const { return std::numeric_limits<int>::min(); }
+
+void LevelElement::Activate() { GetFlags().isActivated = true; }
+
 void LevelElement::TouchedBy(Entity* entity) {}
 
+std::unique_ptr<LevelElement> LevelElement::Clone() const { return std::make_unique<LevelElement>(*this); }
+
 LevelElement::~LevelElement() {
-    if (LevelElement::textures != nullptr) {
-        SDL_DestroyTexture(LevelElement::textures);
-        LevelElement::textures = nullptr;
-    }
     #ifdef DTOR
     std::clog << "~LevelElement Dtor" << std::endl;
     #endif
@@ -73,14 +76,14 @@ Cloud::Cloud(SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect, int shiftText
 void Cloud::Render() {
     // Dest Rect:
     #ifdef COLLISION
-    rectangleRGBA(window->GetRenderer(), texture.DestRect().x, texture.DestRect().y, texture.DestRect().x + texture.DestRect().w, texture.DestRect().y + texture.DestRect().h, 0, 255, 0, 255);
+    rectangleRGBA(window->GetRenderer(), Sprite().DestRect().x, Sprite().DestRect().y, Sprite().DestRect().x + Sprite().DestRect().w, Sprite().DestRect().y + Sprite().DestRect().h, 0, 255, 0, 255);
     #endif
 
-    SDL_Rect tempSrcRect = texture.SrcRect();
-    if (isRemoved)  // Evil
+    SDL_Rect tempSrcRect = Sprite().SrcRect();
+    if (GetFlags().isRemoved)  // Evil
         tempSrcRect.x += shiftTextureRight;
     
-    SDL_RenderCopy(Texture::renderer, texture.GetTexture(), &tempSrcRect, &texture.DestRect());
+    SDL_RenderCopy(Texture::renderer, Sprite().GetTexture(), &tempSrcRect, &Sprite().DestRect());
 }
 
 void Cloud::TouchedBy(Entity* entity) {
@@ -88,13 +91,15 @@ void Cloud::TouchedBy(Entity* entity) {
         return;
     else if (Player* player = dynamic_cast<Player*>(entity)) {
         player->Kill();
-        this->isRemoved = true;    // Change to Evil
+        this->GetFlags().isRemoved = true;    // Change to Evil
         return;
     }
     else
         throw "Unknown entity!";
 }
 
+std::unique_ptr<LevelElement> Cloud::Clone() const { return std::make_unique<Cloud>(*this); }
+
 Cloud::~Cloud() {
     #ifdef DTOR
     std::clog << "~Cloud Dtor" << std::endl;
@@ -110,28 +115,27 @@ Fish::Fish(SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect, int activationP
 }
 
 void Fish::Update(float dt) {
-    if (hitBox.x + hitBox.w + 20 < GameObject::screen.x)
-        isRemoved = true;
-    if (isRemoved)
+    if (HitBox().x + HitBox().w + 20 < GameObject::Screen().x)
+        GetFlags().isRemoved = true;
+    if (GetFlags().isRemoved || GetFlags().isActivated == false)
         return;
-    if (!isActivated) {
-        if (activationPoint < Player::GetPosition()) {
-            isActivated = true;
-            playSound = true;
-        }
-        else
-            return;
-    }
 
-    if (faceUp)
-        hitBox.y -= (int) (1.0f * dt);
-    else
-        hitBox.y += (int) (1.0f * dt);
+    float speed = faceUp ? -1.0f : 1.0f;
+    GetRigidBody().Drift(Vector2D(0.0f, speed), dt);
+    GetRigidBody().MoveY(HitBox().y);
 }
 
 void Fish::Reset() {
     LevelElement::Reset();
-    hitBox = spawnPoint;
+    HitBox() = spawnPoint;
+    GetRigidBody().Reset();
+}
+
+int Fish::GetActivationPoint() const { return activationPoint + 1; }
+
+void Fish::Activate() {
+    LevelElement::Activate();
+    GetFlags().playSound = true;
 }
 
 void Fish::TouchedBy(Entity* entity) {
@@ -145,6 +149,8 @@ void Fish::TouchedBy(Entity* entity) {
         throw "Unknown entity!";
 }
 
+std::unique_ptr<LevelElement> Fish::Clone() const { return std::make_unique<Fish>(*this); }
+
 Fish::~Fish() {
     #ifdef DTOR
     std::clog << "~Fish Dtor" << std::endl;
@@ -160,28 +166,29 @@ Laser::Laser(SDL_Rect hitBox, SDL_Rect srcRect, SDL_Rect destRect, int activatio
 }
 
 void Laser::Update(float dt) {
-    if (hitBox.x + hitBox.w + 20 < GameObject::screen.x)
-        isRemoved = true;
-    if (isRemoved)
+    if (HitBox().x + HitBox().w + 20 < GameObject::Screen().x)
+        GetFlags().isRemoved = true;
+    if (GetFlags().isRemoved || GetFlags().isActivated == false)
         return;
-    if (!isActivated) {
-        if (activationPoint < Player::GetPosition()) {
-            isActivated = true;
-            playSound = true;
-        }
-        else
-            return;
-    }
 
-    if (faceLeft)
-        hitBox.x -= (int) (2.0f * dt);
-    else
-        hitBox.x += (int) (2.0f * dt);
+    float speed = faceLeft ? -2.0f : 2.0f;
+    GetRigidBody().Drift(Vector2D(speed, 0.0f), dt);
+    GetRigidBody().MoveX(HitBox().x);
 }
 
 void Laser::Reset() {
     LevelElement::Reset();
-    hitBox = spawnPoint;
+    HitBox() = spawnPoint;
+    GetRigidBody().Reset();
+}
+
+int Laser::GetActivationPoint() const { return activationPoint + 1; }
+
+bool Laser::IsFacingLeft() const { return faceLeft; }
+
+void Laser::Activate() {
+    LevelElement::Activate();
+    GetFlags().playSound = true;
 }
 
 void Laser::TouchedBy(Entity* entity) {
@@ -195,6 +202,8 @@ void Laser::TouchedBy(Entity* entity) {
         throw "Unknown entity!";
 }
 
+std::unique_ptr<LevelElement> Laser::Clone() const { return std::make_unique<Laser>(*this); }
+
 Laser::~Laser() {
     #ifdef DTOR
     std::clog << "~Laser Dtor" << std::endl;
@@ -213,6 +222,8 @@ void Tube::TouchedBy(Entity* entity) {
     entity->LimitedBy(this);
 }
 
+std::unique_ptr<LevelElement> Tube::Clone() const { return std::make_unique<Tube>(*this); }
+
 Tube::~Tube() {
     #ifdef DTOR
     std::clog << "~Tube Dtor" << std::endl;
@@ -234,16 +245,18 @@ void CheckpointFlag::TouchedBy(Entity* entity) {
         if (isReached)
             return;
 
-        this->isRemoved = true;
+        this->GetFlags().isRemoved = true;
         this->isReached = true;
-        player->SpawnPoint().x = this->hitBox.x;
-        player->SpawnPoint().y = this->hitBox.y + 50;
+        player->SpawnPoint().x = this->HitBox().x;
+        player->SpawnPoint().y = this->HitBox().y + 50;
         return;
     }
     else
         throw "Unknown entity!";
 }
 
+std::unique_ptr<LevelElement> CheckpointFlag::Clone() const { return std::make_unique<CheckpointFlag>(*this); }
+
 CheckpointFlag::~CheckpointFlag() {
     #ifdef DTOR
     std::clog << "~CheckpointFlag Dtor" << std::endl;
@@ -266,14 +279,16 @@ void EndFlag::TouchedBy(Entity* entity) {
             return;
         
         player->SetBottomOfFlag(this->HitBox().y + this->HitBox().h - 5);
-        player->HitBox().x = this->hitBox.x - player->HitBox().w + 20;
-        playSound = true;
+        player->HitBox().x = this->HitBox().x - player->HitBox().w + 20;
+        GetFlags().playSound = true;
         return;
     }
     else
         throw "Unknown entity!";
 }
 
+std::unique_ptr<LevelElement> EndFlag::Clone() const { return std::make_unique<EndFlag>(*this); }
+
 EndFlag::~EndFlag() {
     #ifdef DTOR
     std::clog << "~EndFlag Dtor" << std::endl;
@@ -292,8 +307,8 @@ void House::TouchedBy(Entity* entity) {
     if (dynamic_cast<Enemy*>(entity))
         return;
     else if (Player* player = dynamic_cast<Player*>(entity)) {
-        if (player->IsForcedByFlag() && player->HitBox().x > this->hitBox.x + (this->hitBox.w/2) && !isReached) {
-            Level::isCompleted = true;
+        if (player->IsForcedByFlag() && player->HitBox().x > this->HitBox().x + (this->HitBox().w/2) && !isReached) {
+            World::Current().isCompleted = true;
             isReached = true;
         }
     }
@@ -301,6 +316,8 @@ void House::TouchedBy(Entity* entity) {
         throw "Unknown entity!";
 }
 
+std::unique_ptr<LevelElement> House::Clone() const { return std::make_unique<House>(*this); }
+
 House::~House() {
     #ifdef DTOR
     std::clog << "~House Dtor" << std::endl;
@@ -0,0 +1,162 @@
+/** @file LevelGenerator.cpp
+  * @brief Contains the implementation of LevelGenerator.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "LevelGenerator.h"
+
+const int LevelGenerator::height = 12;
+const int LevelGenerator::blockSize = 75;
+const int LevelGenerator::groundY = 750;
+
+LevelGenerator::LevelGenerator(const GeneratorConfig& config) : config(config), random(config.seed) {
+    if (config.width < 40)
+        throw std::runtime_error("Level width must be at least 40 blocks!");
+    if (config.blockDensity < 0.0f || config.blockDensity > 1.0f)
+        throw std::runtime_error("Block density must be between 0 and 1!");
+}
+
+void LevelGenerator::Generate(std::ostream& out) {
+    random.seed(config.seed);
+
+    WriteGround(out);
+    WriteBlocks(out);
+
+    WriteEnemies(out, "CommonEnemy", config.commonEnemies, 68);
+    WriteEnemies(out, "SoldierEnemy", config.soldierEnemies, 92);
+    WriteEnemies(out, "KingEnemy", config.kingEnemies, 82);
+    WriteEnemies(out, "RedMushroomEnemy", config.redMushroomEnemies, 73);
+    WriteEnemies(out, "PurpleMushroomEnemy", config.purpleMushroomEnemies, 75);
+
+    WriteElements(out);
+}
+
+void LevelGenerator::Generate(const std::string& path) {
+    std::ofstream file(path);
+    if (!file)
+        throw std::runtime_error("Unable to open level file: " + path);
+    Generate(file);
+}
+
+LevelGenerator::~LevelGenerator() {
+    #ifdef DTOR
+    std::clog << "~LevelGenerator Dtor" << std::endl;
+    #endif
+}
+/* ************************************************************************************ */
+
+/***** Private Functions *****/
+int LevelGenerator::RandomInt(int min, int max) {
+    return std::uniform_int_distribution<int>(min, max)(random);
+}
+
+int LevelGenerator::EndFlagX() const { return config.width * blockSize - 891; }
+
+void LevelGenerator::WriteGround(std::ostream& out) {
+    out << "Grid\n(" << config.width << ',' << height << ")\n";
+    out << "Player\n(60,665)\n";
+
+    out << "UpperDirtBlock\n" << config.width << '\n';
+    for (int column = 0; column < config.width; ++column)
+        out << "(10," << column << ")\n";
+
+    out << "LowerDirtBlock\n" << config.width << '\n';
+    for (int column = 0; column < config.width; ++column)
+        out << "(11," << column << ")\n";
+}
+
+void LevelGenerator::WriteBlocks(std::ostream& out) {
+    const char* names[] = { "BrickBlock", "BoxyBlock", "HiddenBlock", "MysteryBlock" };
+    const int floatingRows[] = { 3, 6 };
+    std::vector<std::pair<int,int>> blocks[4];
+    std::uniform_real_distribution<float> chance(0.0f, 1.0f);
+
+    // Keep the spawn point and the end flag free
+    for (int row : floatingRows)
+        for (int column = 8; column < config.width - 20; ++column)
+            if (chance(random) < config.blockDensity)
+                blocks[RandomInt(0, 3)].push_back({row, column});
+
+    for (int type = 0; type < 4; ++type) {
+        if (blocks[type].empty())
+            continue;
+        out << names[type] << '\n' << blocks[type].size() << '\n';
+        for (auto& block : blocks[type])
+            out << '(' << block.first << ',' << block.second << ")\n";
+    }
+}
+
+void LevelGenerator::WriteEnemies(std::ostream& out, const std::string& name, int count, int hitBoxHeight) {
+    if (count <= 0)
+        return;
+
+    std::vector<int> positions;
+    positions.reserve(count);
+    for (int i = 0; i < count; ++i)
+        positions.push_back(RandomInt(1000, EndFlagX() - 500));
+    std::sort(positions.begin(), positions.end());
+
+    out << name << '\n' << count << '\n';
+    for (int x : positions) {
+        bool faceLeft = RandomInt(0, 4) != 0;
+        out << '(' << x << ',' << groundY - hitBoxHeight << ") " << std::max(0, x - 700) << (faceLeft ? " true\n" : " false\n");
+    }
+}
+
+void LevelGenerator::WriteElements(std::ostream& out) {
+    // Fish: every second one jumps up from the bottom, the others fall from the top
+    if (config.fish > 0) {
+        out << "Fish\n" << config.fish << '\n';
+        for (int i = 0; i < config.fish; ++i) {
+            int x = RandomInt(1000, EndFlagX() - 500);
+            if (i % 2 == 0)
+                out << '(' << x << ",900) " << x - 300 << " true\n";
+            else
+                out << '(' << x << ",-77) " << x - 50 << " false\n";
+        }
+    }
+
+    if (config.lasers > 0) {
+        const int heights[] = { 150, 400, 635 };
+        out << "Laser\n" << config.lasers << '\n';
+        for (int i = 0; i < config.lasers; ++i) {
+            int x = RandomInt(1500, EndFlagX() - 500);
+            out << '(' << x << ',' << heights[RandomInt(0, 2)] << ") " << x - 150 << " true\n";
+        }
+    }
+
+    // Tubes are placed on the ground
+    if (config.tubes > 0) {
+        const char* names[] = { "HighTube", "MiddleTube", "LowTube" };
+        const int tubeHeights[] = { 290, 220, 147 };
+        std::vector<int> tubes[3];
+        for (int i = 0; i < config.tubes; ++i)
+            tubes[RandomInt(0, 2)].push_back(RandomInt(1000, EndFlagX() - 500));
+
+        for (int type = 0; type < 3; ++type) {
+            if (tubes[type].empty())
+                continue;
+            out << names[type] << '\n' << tubes[type].size() << '\n';
+            for (int x : tubes[type])
+                out << '(' << x << ',' << groundY - tubeHeights[type] << ")\n";
+        }
+    }
+
+    if (config.clouds > 0) {
+        out << "Cloud\n" << config.clouds << '\n';
+        for (int i = 0; i < config.clouds; ++i)
+            out << '(' << RandomInt(0, EndFlagX() - 500) << ',' << RandomInt(75, 300) << ")\n";
+    }
+
+    // The level has to be completable
+    out << "EndFlag\n1\n(" << EndFlagX() << ",75)\n";
+    out << "House\n1\n(" << config.width * blockSize - 450 << ",532)\n";
+}
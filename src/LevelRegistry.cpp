@@ -0,0 +1,151 @@
+/** @file LevelRegistry.cpp
+  * @brief Contains the implementation of LevelRegistry.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <cstring>
+#include <cstdint>
+
+#include "LevelRegistry.h"
+#include "PixelCache.h"
+
+/***** Class LevelRegistry *****/
+const std::uint32_t LevelRegistry::version = 1;
+const size_t LevelRegistry::none = (size_t) -1;
+
+std::unique_ptr<LevelRegistry> LevelRegistry::Load(std::string_view manifest, const std::string& cachePath, const Reader& read, bool isRebuilt) {
+    std::unique_ptr<LevelRegistry> registry(new LevelRegistry());
+    std::uint64_t hash = PixelCache::Hash(manifest);
+
+    // The index is stored as a single row of bytes
+    if (cachePath.empty() == false && isRebuilt == false) {
+        auto mapping = std::make_unique<PixelCache>();
+        if (mapping->Open(cachePath, hash, version)) {
+            const PixelCache::Header& cacheHeader = mapping->GetHeader();
+            if (registry->Attach(std::string_view((const char*) mapping->GetPixels(), cacheHeader.pitch))) {
+                registry->mapping = std::move(mapping);
+                return registry;
+            }
+        }
+    }
+
+    // Cache miss (or a stale cache): scan the manifest and write the cache
+    std::istringstream file{std::string(manifest)};
+    registry->compiled = Compile(file, read);
+    std::int32_t size = (std::int32_t) registry->compiled.size();
+    if (cachePath.empty() == false && !PixelCache::Store(cachePath, { {}, 0, hash, version, size, 1, size }, registry->compiled.data()))
+        std::cerr << "Failed to write level index cache: " << cachePath << std::endl;
+    registry->Attach(registry->compiled);
+    return registry;
+}
+
+std::string LevelRegistry::Compile(std::istream& manifest, const Reader& read) {
+    std::vector<Record> levels;
+    std::string strings;
+
+    std::string line;
+    while (std::getline(manifest, line)) {
+        // The path and the optional name are separated by whitespace
+        size_t begin = line.find_first_not_of(" \t\r");
+        if (begin == std::string::npos || line[begin] == '#')
+            continue;
+        size_t end = line.find_first_of(" \t\r", begin);
+        std::string path = line.substr(begin, end - begin);
+        std::string name;
+        size_t nameBegin = end == std::string::npos ? std::string::npos : line.find_first_not_of(" \t\r", end);
+        if (nameBegin != std::string::npos)
+            name = line.substr(nameBegin, line.find_last_not_of(" \t\r") - nameBegin + 1);
+
+        std::string buffer;
+        std::string_view level = read(path, buffer);
+        if (level.data() == nullptr) {
+            std::cerr << "Level not found, it is skipped: " << path << std::endl;
+            continue;
+        }
+
+        Record record;
+        record.size = level.size();
+        record.checksum = PixelCache::Hash(level);
+        record.name = (std::uint32_t) strings.size();
+        strings.append(name);
+        strings.push_back('\0');
+        record.path = (std::uint32_t) strings.size();
+        strings.append(path);
+        strings.push_back('\0');
+        levels.push_back(record);
+    }
+
+    // Build the index
+    Header header;
+    std::memcpy(header.magic, "CMLV", 4);
+    header.version = version;
+    header.count = (std::uint32_t) levels.size();
+    header.reserved = 0;
+
+    std::string table;
+    table.append((const char*) &header, sizeof(header));
+    table.append((const char*) levels.data(), levels.size() * sizeof(Record));
+    table.append(strings);
+    return table;
+}
+
+size_t LevelRegistry::GetCount() const { return header->count; }
+
+LevelRegistry::Entry LevelRegistry::GetEntry(size_t index) const {
+    if (index >= header->count)
+        throw std::out_of_range("Level index out of range!");
+    const Record& record = records[index];
+    return { strings + record.name, strings + record.path, record.size, record.checksum };
+}
+
+bool LevelRegistry::Matches(size_t index, std::string_view level) const {
+    Entry entry = GetEntry(index);
+    return entry.size == level.size() && entry.checksum == PixelCache::Hash(level);
+}
+
+LevelRegistry::~LevelRegistry() {
+    #ifdef DTOR
+    std::clog << "~LevelRegistry Dtor" << std::endl;
+    #endif
+}
+/* ************************************************************************************ */
+
+/***** Private Functions *****/
+LevelRegistry::LevelRegistry() : header(nullptr), records(nullptr), strings(nullptr) {}
+
+bool LevelRegistry::Attach(std::string_view table) {
+    if (table.size() < sizeof(Header))
+        return false;
+
+    const Header* tableHeader = (const Header*) table.data();
+    if (std::memcmp(tableHeader->magic, "CMLV", 4) != 0 || tableHeader->version != version)
+        return false;
+
+    std::uint64_t recordsSize = (std::uint64_t) tableHeader->count * sizeof(Record);
+    if (table.size() < sizeof(Header) + recordsSize)
+        return false;
+
+    // Every string has to start inside the table, and the last one has to be null-terminated
+    const Record* tableRecords = (const Record*) (table.data() + sizeof(Header));
+    const char* tableStrings = table.data() + sizeof(Header) + recordsSize;
+    std::uint64_t stringsSize = table.size() - sizeof(Header) - recordsSize;
+    if (stringsSize > 0 && tableStrings[stringsSize - 1] != '\0')
+        return false;
+    for (std::uint32_t i = 0; i < tableHeader->count; ++i)
+        if (tableRecords[i].name >= stringsSize || tableRecords[i].path >= stringsSize)
+            return false;
+
+    header = tableHeader;
+    records = tableRecords;
+    strings = tableStrings;
+    return true;
+}
+/* ************************************************************************************ */
@@ -0,0 +1,179 @@
+/** @file LevelSolver.cpp
+  * @brief Contains the implementation of LevelSolver.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef CPORTA
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <algorithm>
+#include <unordered_set>
+#include <cmath>
+#include <cstdint>
+
+#include "LevelSolver.h"
+#include "Level.h"
+#include "Entity.h"
+#include "World.h"
+#include "Assets.h"
+
+const PlayerInput LevelSolver::actions[] = {
+    { false, true, false, false },  // Right
+    { false, true, true, false },   // Right + Jump
+    { false, false, true, false },  // Jump
+    { false, false, false, false }, // Idle
+    { true, false, false, false },  // Left
+    { true, false, true, false }    // Left + Jump
+};
+const int LevelSolver::actionCount = sizeof(actions) / sizeof(actions[0]);
+
+LevelSolver::LevelSolver(const SolverConfig& config) : config(config) {
+    if (config.beamWidth <= 0)
+        throw std::runtime_error("Beam width must be positive!");
+    if (config.ticksPerAction <= 0)
+        throw std::runtime_error("Ticks per action must be positive!");
+    if (this->config.threads <= 0)
+        this->config.threads = std::max(1u, std::thread::hardware_concurrency());
+}
+
+SolverResult LevelSolver::Solve(const std::string& configFile) const {
+    SolverResult result;
+
+    if (Assets::OpenStream(configFile) == nullptr)
+        throw std::runtime_error("Unable to open level file: " + configFile);
+
+    Node root;
+    root.level = std::make_unique<Level>(configFile, nullptr);
+    root.level->SetSeed(config.seed);
+    root.progress = root.level->GetPlayer().HitBox().x;
+    root.isDead = false;
+    result.furthestX = root.progress;
+
+    std::vector<Node> beam;
+    beam.push_back(std::move(root));
+    std::vector<unsigned char> bestPath;
+    int stall = 0;
+
+    for (int depth = 0; depth < config.maxActions && stall < config.stallLimit; ++depth) {
+        std::vector<Node> children = ExpandBeam(beam);
+        result.simulatedTicks += (long long) children.size() * config.ticksPerAction;
+
+        // The furthest states first, ties are kept in the order of the actions
+        std::stable_sort(children.begin(), children.end(), [](const Node& lhs, const Node& rhs) {
+            return lhs.progress > rhs.progress;
+        });
+
+        beam.clear();
+        std::unordered_set<std::uint64_t> visited;
+        for (auto& child : children) {
+            if (child.isDead)
+                continue;
+            if (child.level->GetWorld().isCompleted) {
+                result.isCompleted = true;
+                result.furthestX = std::max(result.furthestX, child.progress);
+                bestPath = child.path;
+                beam.clear();
+                break;
+            }
+            if (visited.insert(StateKey(child)).second == false)
+                continue;
+            beam.push_back(std::move(child));
+            if ((int) beam.size() >= config.beamWidth)
+                break;
+        }
+        if (result.isCompleted || beam.empty())
+            break;
+
+        if (beam.front().progress > result.furthestX) {
+            result.furthestX = beam.front().progress;
+            bestPath = beam.front().path;
+            stall = 0;
+        }
+        else
+            ++stall;
+    }
+
+    for (unsigned char action : bestPath)
+        result.actions.push_back(actions[action]);
+    return result;
+}
+
+void LevelSolver::WriteInputs(std::ostream& out, const SolverResult& result) const {
+    for (const PlayerInput& input : result.actions) {
+        out << config.ticksPerAction << ' ';
+        if (input.left) out << 'L';
+        if (input.right) out << 'R';
+        if (input.up) out << 'U';
+        if (!input.left && !input.right && !input.up) out << '-';
+        out << '\n';
+    }
+}
+
+LevelSolver::~LevelSolver() {
+    #ifdef DTOR
+    std::clog << "~LevelSolver Dtor" << std::endl;
+    #endif
+}
+/* ************************************************************************************ */
+
+/***** Private Functions *****/
+void LevelSolver::Expand(Node& node, int action) const {
+    for (int tick = 0; tick < config.ticksPerAction; ++tick) {
+        node.level->Step(actions[action], (float) config.frameDelay);
+        if (node.level->GetPlayer().IsDead() || node.level->GetWorld().isCompleted)
+            break;
+    }
+    node.isDead = node.level->GetPlayer().IsDead();
+    node.progress = node.level->GetPlayer().HitBox().x;
+    node.path.push_back((unsigned char) action);
+}
+
+std::vector<LevelSolver::Node> LevelSolver::ExpandBeam(const std::vector<Node>& beam) const {
+    std::vector<Node> children(beam.size() * actionCount);
+
+    // Every worker takes every n-th child, so each level clone is simulated by a single thread
+    auto work = [&](int first) {
+        for (size_t i = first; i < children.size(); i += config.threads) {
+            const Node& parent = beam[i / actionCount];
+            children[i].level = parent.level->Clone();
+            children[i].path = parent.path;
+            Expand(children[i], i % actionCount);
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (int first = 1; first < config.threads; ++first)
+        workers.emplace_back(work, first);
+    work(0);
+    for (auto& worker : workers)
+        worker.join();
+
+    return children;
+}
+
+/**
+ * @param value Signed value of the field.
+ * @param bits Width of the field.
+ * @return Returns the value shifted into [0, 2^bits) (values out of range are clamped to the nearest end).
+ */
+static std::uint64_t PackField(long long value, int bits) {
+    long long offset = 1LL << (bits - 1);
+    value = std::clamp(value + offset, 0LL, (1LL << bits) - 1);
+    return (std::uint64_t) value;
+}
+
+std::uint64_t LevelSolver::StateKey(Node& node) {
+    Player& player = node.level->GetPlayer();
+    std::uint64_t x = PackField(player.HitBox().x / 4, 24);
+    std::uint64_t y = PackField(player.HitBox().y / 4, 24);
+    std::uint64_t vx = PackField(std::lround(player.GetRigidBody().Velocity().x * 2.0f), 8);
+    std::uint64_t vy = PackField(std::lround(player.GetRigidBody().Velocity().y * 2.0f), 8);
+    return (x << 40) | (y << 16) | (vx << 8) | vy;
+}
+
+#endif // CPORTA
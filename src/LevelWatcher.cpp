@@ -0,0 +1,83 @@
+/** @file LevelWatcher.cpp
+  * @brief Contains the implementation of LevelWatcher.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#include <iostream>
+#include <string>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+#include "LevelWatcher.h"
+
+LevelWatcher::LevelWatcher() : fileDescriptor(-1), watchDescriptor(-1) {
+    #ifdef __linux__
+    fileDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fileDescriptor < 0)
+        std::cerr << "Failed to initialise inotify, level reloading is disabled" << std::endl;
+    #endif
+}
+
+void LevelWatcher::Watch(const std::string& path) {
+    Stop();
+    if (fileDescriptor < 0)
+        return;
+
+    size_t slash = path.find_last_of('/');
+    std::string directory = (slash == std::string::npos) ? "." : path.substr(0, slash);
+    fileName = (slash == std::string::npos) ? path : path.substr(slash + 1);
+
+    #ifdef __linux__
+    watchDescriptor = inotify_add_watch(fileDescriptor, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (watchDescriptor < 0)
+        std::cerr << "Failed to watch directory: " << directory << std::endl;
+    else
+        HasChanged();   // Drop the events of the previous file
+    #endif
+}
+
+void LevelWatcher::Stop() {
+    #ifdef __linux__
+    if (watchDescriptor >= 0)
+        inotify_rm_watch(fileDescriptor, watchDescriptor);
+    #endif
+    watchDescriptor = -1;
+}
+
+bool LevelWatcher::HasChanged() {
+    bool changed = false;
+
+    #ifdef __linux__
+    if (watchDescriptor < 0)
+        return false;
+
+    alignas(inotify_event) char buffer[4096];
+    ssize_t length;
+    while ((length = read(fileDescriptor, buffer, sizeof(buffer))) > 0) {
+        char* ptr = buffer;
+        while (ptr < buffer + length) {
+            const inotify_event* event = (const inotify_event*) ptr;
+            if (event->wd == watchDescriptor && event->len > 0 && fileName == event->name)
+                changed = true;
+            ptr += sizeof(inotify_event) + event->len;
+        }
+    }
+    #endif
+
+    return changed;
+}
+
+LevelWatcher::~LevelWatcher() {
+    Stop();
+    #ifdef __linux__
+    if (fileDescriptor >= 0)
+        close(fileDescriptor);
+    #endif
+    #ifdef DTOR
+    std::clog << "~LevelWatcher Dtor" << std::endl;
+    #endif
+}
@@ -0,0 +1,122 @@
+/** @file Mixer.cpp
+  * @brief Contains the implementation of Mixer.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#include <iostream>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include <algorithm>
+
+#include "Mixer.h"
+
+Mixer::Mixer(int voiceCount, int queueSize, std::uint64_t repeatInterval, int maxInstances)
+    : voices(voiceCount), commands(queueSize + 1), head(0), tail(0), clock(0), repeatInterval(repeatInterval), maxInstances(maxInstances)
+    {
+    if (voiceCount <= 0 || queueSize <= 0 || maxInstances <= 0)
+        throw "Invalid mixer size!";
+}
+
+bool Mixer::Push(const Command& command) {
+    size_t current = tail.load(std::memory_order_relaxed);
+    size_t next = (current + 1) % commands.size();
+    if (next == head.load(std::memory_order_acquire))
+        return false;
+
+    commands[current] = command;
+    tail.store(next, std::memory_order_release);
+    return true;
+}
+
+void Mixer::Mix(std::int16_t* stream, size_t count) {
+    size_t current = head.load(std::memory_order_relaxed);
+    while (current != tail.load(std::memory_order_acquire)) {
+        const Command& command = commands[current];
+        if (command.type == Command::PLAY)
+            Start(command);
+        else
+            for (Voice& voice : voices)
+                voice.samples = nullptr;
+        current = (current + 1) % commands.size();
+        head.store(current, std::memory_order_release);
+    }
+
+    for (Voice& voice : voices) {
+        for (size_t i = 0; i < count && voice.samples != nullptr; ++i) {
+            int sample = stream[i] + voice.samples[voice.position];
+            stream[i] = (std::int16_t) std::clamp(sample, -32768, 32767);
+
+            if (++voice.position == voice.length) {
+                voice.position = 0;
+                if (voice.loop == false)
+                    voice.samples = nullptr;
+            }
+        }
+    }
+    clock += count;
+}
+
+void Mixer::Stop(int sound) {
+    for (Voice& voice : voices)
+        if (voice.samples != nullptr && voice.sound == sound)
+            voice.samples = nullptr;
+}
+
+int Mixer::ActiveVoices() const {
+    return (int) std::count_if(voices.begin(), voices.end(), [](const Voice& voice) { return voice.samples != nullptr; });
+}
+
+Mixer::~Mixer() {
+    #ifdef DTOR
+    std::clog << "~Mixer Dtor" << std::endl;
+    #endif
+}
+/* ************************************************************************************ */
+
+/***** Private Functions *****/
+void Mixer::Start(const Command& command) {
+    if (command.samples == nullptr || command.length == 0)
+        return;
+
+    Voice* free = nullptr;
+    Voice* oldestSame = nullptr;
+    Voice* victim = nullptr;
+    int instances = 0;
+
+    for (Voice& voice : voices) {
+        if (voice.samples == nullptr) {
+            if (free == nullptr)
+                free = &voice;
+            continue;
+        }
+        if (voice.sound == command.sound) {
+            // Rate limiting: the sound has just been started
+            if (clock - voice.started < repeatInterval)
+                return;
+            ++instances;
+            if (oldestSame == nullptr || voice.started < oldestSame->started)
+                oldestSame = &voice;
+        }
+        if (victim == nullptr || voice.priority < victim->priority
+            || (voice.priority == victim->priority && voice.started < victim->started))
+            victim = &voice;
+    }
+
+    Voice* target = free;
+    if (instances >= maxInstances)
+        target = oldestSame;
+    else if (target == nullptr && victim != nullptr && victim->priority <= command.priority)
+        target = victim;
+    if (target == nullptr)
+        return;
+
+    target->samples = command.samples;
+    target->length = command.length;
+    target->position = 0;
+    target->sound = command.sound;
+    target->priority = command.priority;
+    target->loop = command.loop;
+    target->started = clock;
+}
@@ -0,0 +1,209 @@
+/** @file ParticleSystem.cpp
+  * @brief Contains the implementation of ParticleSystem.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef CPORTA
+
+#include <SDL2/SDL.h>
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <cmath>
+#include <algorithm>
+
+#include "ParticleSystem.h"
+#include "Texture.h"
+
+const ParticleSystem::Emitter ParticleSystem::emitters[TYPE_COUNT] = {
+    // lifeTime gravity  colour                  fade
+    { 0.5f,     0.0f,    {255, 255, 255, 255},   false },   // COIN
+    { 1.0f,     1800.0f, {255, 255, 255, 255},   false },   // DEBRIS
+    { 0.3f,     0.0f,    {255, 255, 255, 255},   true },    // POP
+    { 0.2f,     0.0f,    {255, 60, 40, 255},     true }     // TRAIL
+};
+
+const SDL_Rect ParticleSystem::frames[] = {
+    {0, 0, 20, 28},     // Coin
+    {20, 0, 15, 15}, {35, 0, 15, 15}, {20, 15, 15, 15}, {35, 15, 15, 15},   // Quarters of the brick
+    {52, 2, 4, 4}       // Blank (inside a larger square, so filtering does not blur its edges)
+};
+const int ParticleSystem::atlasWidth = 64;
+const int ParticleSystem::atlasHeight = 32;
+
+ParticleSystem::ParticleSystem() : atlas(nullptr), count(0) {
+    //
+}
+
+void ParticleSystem::EmitCoin(int x, int y) {
+    Emit(COIN, 0, {(float) x - 25.0f, (float) y - 50.0f, 50.0f, 70.0f}, 0.0f, -500.0f);
+}
+
+void ParticleSystem::EmitDebris(int x, int y) {
+    const float size = 37.0f;
+    for (Uint8 quarter = 0; quarter < 4; ++quarter) {
+        float left = (quarter % 2 == 0) ? -1.0f : 1.0f;
+        float top = (quarter < 2) ? 1.0f : 0.0f;
+        Emit(DEBRIS, 1 + quarter, {x + (quarter % 2) * size, y + (quarter / 2) * size, size, size},
+            left * Spread(100.0f, 200.0f), -Spread(350.0f, 450.0f) - top * 150.0f);
+    }
+}
+
+void ParticleSystem::EmitPop(int x, int y) {
+    for (int i = 0; i < 8; ++i) {
+        float angle = (float) i * 0.785398f + Spread(-0.2f, 0.2f);   // 8 directions (pi / 4 apart)
+        float speed = Spread(200.0f, 300.0f);
+        Emit(POP, 5, {x + 30.0f, y + 30.0f, 12.0f, 12.0f}, speed * std::cos(angle), speed * std::sin(angle));
+    }
+}
+
+void ParticleSystem::EmitTrail(int x, int y) {
+    Emit(TRAIL, 5, {(float) x, y - 5.0f + Spread(-8.0f, 8.0f), 10.0f, 10.0f}, 0.0f, Spread(-40.0f, 40.0f));
+}
+
+void ParticleSystem::Update(float dt) {
+    const float seconds = dt / 1000.0f;
+
+    // Plain loops over the arrays (the compiler can vectorize them)
+    for (size_t i = 0; i < count; ++i)
+        vy[i] += ay[i] * seconds;
+    for (size_t i = 0; i < count; ++i) {
+        x[i] += vx[i] * seconds;
+        y[i] += vy[i] * seconds;
+        life[i] -= seconds;
+    }
+
+    // Remove the expired particles by moving the last one to their place
+    size_t i = 0;
+    while (i < count) {
+        if (life[i] > 0.0f) {
+            ++i;
+            continue;
+        }
+        --count;
+        x[i] = x[count];
+        y[i] = y[count];
+        vx[i] = vx[count];
+        vy[i] = vy[count];
+        ay[i] = ay[count];
+        life[i] = life[count];
+        width[i] = width[count];
+        height[i] = height[count];
+        type[i] = type[count];
+        frame[i] = frame[count];
+    }
+}
+
+void ParticleSystem::Render(int cameraX, SDL_Renderer* renderer) {
+    if (count == 0 || renderer == nullptr)
+        return;
+    if (atlas == nullptr)
+        CreateAtlas();
+
+    vertices.clear();
+    for (size_t i = 0; i < count; ++i) {
+        const Emitter& emitter = emitters[type[i]];
+        const SDL_Rect& src = frames[frame[i]];
+        SDL_Color colour = emitter.colour;
+        if (emitter.fade)
+            colour.a = (Uint8) (255.0f * std::clamp(life[i] / emitter.lifeTime, 0.0f, 1.0f));
+
+        float left = x[i] - (float) cameraX;
+        float top = y[i];
+        float right = left + width[i];
+        float bottom = top + height[i];
+        float u1 = (float) src.x / atlasWidth;
+        float v1 = (float) src.y / atlasHeight;
+        float u2 = (float) (src.x + src.w) / atlasWidth;
+        float v2 = (float) (src.y + src.h) / atlasHeight;
+
+        vertices.push_back({ {left, top}, colour, {u1, v1} });
+        vertices.push_back({ {right, top}, colour, {u2, v1} });
+        vertices.push_back({ {left, bottom}, colour, {u1, v2} });
+        vertices.push_back({ {right, bottom}, colour, {u2, v2} });
+    }
+
+    SDL_RenderGeometry(renderer, atlas, vertices.data(), (int) vertices.size(), indices.data(), (int) count * 6);
+}
+
+void ParticleSystem::Clear() { count = 0; }
+
+size_t ParticleSystem::GetCount() const { return count; }
+
+ParticleSystem::~ParticleSystem() {
+    if (atlas != nullptr)
+        SDL_DestroyTexture(atlas);
+    #ifdef DTOR
+    std::clog << "~ParticleSystem Dtor" << std::endl;
+    #endif
+}
+/* ************************************************************************************ */
+
+/***** Private Functions *****/
+void ParticleSystem::Emit(Type particleType, Uint8 particleFrame, SDL_FRect rect, float velocityX, float velocityY) {
+    if (count == capacity)
+        return;
+
+    x[count] = rect.x;
+    y[count] = rect.y;
+    vx[count] = velocityX;
+    vy[count] = velocityY;
+    ay[count] = emitters[particleType].gravity;
+    life[count] = emitters[particleType].lifeTime;
+    width[count] = rect.w;
+    height[count] = rect.h;
+    type[count] = (Uint8) particleType;
+    frame[count] = particleFrame;
+    ++count;
+}
+
+float ParticleSystem::Spread(float min, float max) {
+    return std::uniform_real_distribution<float>(min, max)(random);
+}
+
+void ParticleSystem::CreateAtlas() {
+    SDL_Renderer* renderer = Texture::renderer;
+    SDL_Texture* coin = Texture::LoadStaticTexture("img/Coin.png");
+    SDL_Texture* blocks = Texture::LoadStaticTexture("img/Block.png");
+
+    atlas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, atlasWidth, atlasHeight);
+    SDL_SetTextureBlendMode(atlas, SDL_BLENDMODE_BLEND);
+
+    // Copy the pieces onto the atlas without blending (the atlas keeps their alpha)
+    SDL_SetTextureBlendMode(coin, SDL_BLENDMODE_NONE);
+    SDL_SetTextureBlendMode(blocks, SDL_BLENDMODE_NONE);
+    SDL_SetRenderTarget(renderer, atlas);
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0); // Transparent
+    SDL_RenderClear(renderer);
+
+    SDL_Rect coinSrc = {0, 0, 20, 28};
+    SDL_RenderCopy(renderer, coin, &coinSrc, &frames[0]);
+    SDL_Rect brickSrc = {60, 0, 30, 30};
+    SDL_Rect brickDest = {20, 0, 30, 30};
+    SDL_RenderCopy(renderer, blocks, &brickSrc, &brickDest);
+    SDL_Rect blank = {50, 0, 8, 8};
+    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+    SDL_RenderFillRect(renderer, &blank);
+
+    // Reset render target to default (screen)
+    SDL_SetRenderTarget(renderer, nullptr);
+
+    if (coin != nullptr)
+        SDL_DestroyTexture(coin);
+    if (blocks != nullptr)
+        SDL_DestroyTexture(blocks);
+
+    // The batch is reserved for the full capacity, so rendering does not allocate
+    vertices.reserve(capacity * 4);
+    indices.reserve(capacity * 6);
+    for (int i = 0; i < (int) capacity; ++i) {
+        int first = i * 4;
+        for (int corner : {0, 1, 2, 2, 1, 3})
+            indices.push_back(first + corner);
+    }
+}
+
+#endif // CPORTA
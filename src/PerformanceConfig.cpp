@@ -0,0 +1,150 @@
+/** @file PerformanceConfig.cpp
+  * @brief Contains the implementation of PerformanceConfig.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstring>
+
+#include "PerformanceConfig.h"
+
+/**
+ * @brief Removes the whitespace from both ends of a string.
+ * @param text The string.
+ * @return Returns the trimmed string.
+ */
+static std::string Trim(const std::string& text) {
+    size_t begin = text.find_first_not_of(" \t\r");
+    if (begin == std::string::npos)
+        return "";
+    size_t end = text.find_last_not_of(" \t\r");
+    return text.substr(begin, end - begin + 1);
+}
+
+/**
+ * @brief Converts a whole string to a number in the given range.
+ * @param value The string.
+ * @param min Smallest accepted number.
+ * @param max Largest accepted number.
+ * @param number The number is written here if the string is valid.
+ * @return Returns whether the string is a valid number in the range.
+ */
+static bool ParseNumber(const std::string& value, int min, int max, int& number) {
+    size_t length = 0;
+    int parsed = 0;
+    try {
+        parsed = std::stoi(value, &length);
+    } catch (...) {
+        return false;
+    }
+    if (length != value.size() || parsed < min || parsed > max)
+        return false;
+    number = parsed;
+    return true;
+}
+
+/***** Struct PerformanceConfig *****/
+bool PerformanceConfig::Set(const std::string& name, const std::string& value, std::ostream& errors) {
+    bool isValid = true;
+    if (name == "fps") isValid = ParseNumber(value, 10, 1000, fps);
+    else if (name == "width") isValid = ParseNumber(value, 320, 7680, width);
+    else if (name == "height") isValid = ParseNumber(value, 180, 4320, height);
+    else if (name == "voices") isValid = ParseNumber(value, 1, 64, voices);
+    else if (name == "threads") isValid = ParseNumber(value, 0, 16, threads);
+    else if (name == "audio-buffer") {
+        // SDL rounds the buffer up to a power of two anyway
+        int size = 0;
+        isValid = ParseNumber(value, 64, 8192, size) && (size & (size - 1)) == 0;
+        if (isValid)
+            audioBuffer = size;
+    }
+    else if (name == "vsync") {
+        isValid = value == "on" || value == "off";
+        if (isValid)
+            vsync = value == "on";
+    }
+    else if (name == "renderer") {
+        isValid = value == "accelerated" || value == "software";
+        if (isValid)
+            software = value == "software";
+    }
+    else {
+        errors << "Unknown performance setting: " << name << std::endl;
+        return false;
+    }
+
+    if (!isValid)
+        errors << "Invalid value for " << name << ": " << value << std::endl;
+    return isValid;
+}
+
+int PerformanceConfig::Load(std::istream& is, const std::string& source, std::ostream& errors) {
+    int invalidLines = 0;
+    std::string line;
+    for (int number = 1; std::getline(is, line); ++number) {
+        line = Trim(line.substr(0, line.find('#')));
+        if (line.empty())
+            continue;
+
+        size_t separator = line.find('=');
+        bool isValid = false;
+        if (separator == std::string::npos)
+            errors << "Missing '=' in the line" << std::endl;
+        else
+            isValid = Set(Trim(line.substr(0, separator)), Trim(line.substr(separator + 1)), errors);
+
+        if (!isValid) {
+            errors << "  (" << source << ", line " << number << ", ignored)" << std::endl;
+            ++invalidLines;
+        }
+    }
+    return invalidLines;
+}
+
+int PerformanceConfig::LoadFile(const std::string& path, std::ostream& errors, bool isRequired) {
+    std::ifstream file(path);
+    if (!file) {
+        if (!isRequired)
+            return 0;
+        errors << "Failed to open the config file: " << path << std::endl;
+        return 1;
+    }
+    return Load(file, path, errors);
+}
+
+int PerformanceConfig::ParseArguments(int argc, const char* const argv[], std::ostream& errors) {
+    static const char* const names[] = { "fps", "vsync", "renderer", "width", "height", "audio-buffer", "voices", "threads" };
+
+    int invalidArguments = 0;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], "--", 2) != 0)
+            continue;
+        const char* name = argv[i] + 2;
+
+        bool isSetting = false;
+        for (const char* setting : names)
+            if (std::strcmp(name, setting) == 0)
+                isSetting = true;
+        if (!isSetting)
+            continue;
+
+        if (i + 1 >= argc) {
+            errors << "Missing value for --" << name << std::endl;
+            ++invalidArguments;
+        }
+        else if (!Set(name, argv[++i], errors))
+            ++invalidArguments;
+    }
+    return invalidArguments;
+}
+
+std::string PerformanceConfig::GetPath(int argc, const char* const argv[], const std::string& defaultPath) {
+    for (int i = 1; i + 1 < argc; ++i)
+        if (std::strcmp(argv[i], "--config") == 0)
+            return argv[i + 1];
+    return defaultPath;
+}
+/* ************************************************************************************ */
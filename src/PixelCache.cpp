@@ -0,0 +1,101 @@
+/** @file PixelCache.cpp
+  * @brief Contains the implementation of PixelCache.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <cstring>
+#include <cstdio>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "PixelCache.h"
+
+const std::uint32_t PixelCache::version = 1;
+
+PixelCache::PixelCache() : data(nullptr), size(0) {}
+
+bool PixelCache::Open(const std::string& path, std::uint64_t sourceHash, std::uint32_t format) {
+    Close();
+
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return false;
+
+    struct stat info;
+    if (fstat(fd, &info) < 0 || info.st_size < (off_t) sizeof(Header)) {
+        close(fd);
+        return false;
+    }
+
+    void* mapped = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapped == MAP_FAILED)
+        return false;
+
+    data = (const char*) mapped;
+    size = info.st_size;
+
+    const Header& header = GetHeader();
+    bool valid = std::memcmp(header.magic, "CMTX", 4) == 0 && header.version == version
+        && header.sourceHash == sourceHash && header.format == format
+        && header.width > 0 && header.height > 0 && header.pitch >= header.width
+        && sizeof(Header) + (std::uint64_t) header.height * header.pitch == size;
+
+    if (!valid)
+        Close();
+    return valid;
+}
+
+void PixelCache::Close() {
+    if (data != nullptr)
+        munmap((void*) data, size);
+    data = nullptr;
+    size = 0;
+}
+
+const PixelCache::Header& PixelCache::GetHeader() const { return *(const Header*) data; }
+
+const void* PixelCache::GetPixels() const { return data + sizeof(Header); }
+
+std::uint64_t PixelCache::Hash(std::string_view data) {
+    std::uint64_t hash = 14695981039346656037ull;
+    for (unsigned char byte : data) {
+        hash ^= byte;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+bool PixelCache::Store(const std::string& path, Header header, const void* pixels) {
+    std::memcpy(header.magic, "CMTX", 4);
+    header.version = version;
+
+    std::string temporary = path + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return false;
+        out.write((const char*) &header, sizeof(header));
+        out.write((const char*) pixels, (std::streamsize) header.height * header.pitch);
+        if (!out) {
+            std::remove(temporary.c_str());
+            return false;
+        }
+    }
+    return std::rename(temporary.c_str(), path.c_str()) == 0;
+}
+
+PixelCache::~PixelCache() {
+    Close();
+    #ifdef DTOR
+    std::clog << "~PixelCache Dtor" << std::endl;
+    #endif
+}
@@ -13,7 +13,9 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <vector>
+#include <memory>
 #include <fstream>
 #include <sstream>
 #include <random>
@@ -21,36 +23,62 @@
 
 #include "RenderWindow.h"
 #include "Texture.h"
+#include "GlyphAtlas.h"
 #include "LanguageModule.h"
 #include "Timer.h"
+#include "Assets.h"
+#include "StartupReport.h"
 
 SDL_Renderer* RenderWindow::renderer = nullptr;
 
 /* ************************************************************************************ */
 
 /***** CLASS FONT *****/
-Font::Font() : fonts(FONT_COUNT, nullptr) { TTF_Init(); }
+Font::Font() : fonts(FONT_COUNT, nullptr), paths(FONT_COUNT), sizes(FONT_COUNT, 0), atlases(FONT_COUNT) { TTF_Init(); }
 
 void Font::LoadFont(const char* path, int size, FontType fontType) {
+    atlases[fontType].reset();
     if (fonts[fontType] != nullptr)
         TTF_CloseFont(fonts[fontType]);
+    fonts[fontType] = nullptr;
 
-    fonts[fontType] = TTF_OpenFont(path, size);
-    if (fonts[fontType] == nullptr) {
+    paths[fontType] = path;
+    sizes[fontType] = size;
+}
+
+TTF_Font* Font::GetFont(FontType font) {
+    if (font == FONT_COUNT)
+        throw "You are trying to get the count instead of a font! Font::GetFont()";
+    if (fonts.at(font) != nullptr)
+        return fonts[font];
+
+    StartupReport::Scope scope(paths[font] + " (" + std::to_string(sizes[font]) + ")");
+    fonts[font] = TTF_OpenFontRW(Assets::Open(paths[font]), 1, sizes[font]);
+    if (fonts[font] == nullptr) {
         SDL_Log("Failed to load font! %s\n", TTF_GetError());
         exit(1);
     }
+    return fonts[font];
 }
 
-TTF_Font* Font::GetFont(FontType font) {
+GlyphAtlas& Font::GetAtlas(FontType font) {
     if (font == FONT_COUNT)
-        throw "You are trying to get the count instead of a font! Font::GetFont()";
-    return fonts.at(font);
+        throw "You are trying to get the count instead of a font! Font::GetAtlas()";
+    if (atlases.at(font) == nullptr)
+        atlases[font].reset(new GlyphAtlas(GetFont(font)));
+    return *atlases[font];
+}
+
+void Font::FreeAtlases() {
+    for (auto& atlas : atlases)
+        atlas.reset();
 }
 
 Font::~Font() {
+    FreeAtlases();
     for (auto it = fonts.begin(); it != fonts.end(); ++it)
-        TTF_CloseFont(*it);
+        if (*it != nullptr)
+            TTF_CloseFont(*it);
     
     #ifdef DTOR
     std::clog << "~Font Dtor" << std::endl;
@@ -88,6 +116,11 @@ void Button::SetSelected(bool selected) {
         selectBox.DeleteTexture();
 }
 
+void Button::SetPosition(int x, int y) {
+    texture.DestRect().x = x;
+    texture.DestRect().y = y;
+}
+
 Button::~Button() {
     #ifdef DTOR
     std::clog << "~Button Dtor" << std::endl;
@@ -95,29 +128,17 @@ Button::~Button() {
 }
 
 TextButton::TextButton(Button::Type buttonType, Lang::CaptionType capType, int x, int y, Colour colour, FontType font, Language language, int bgOpacity, bool isSelected)
-    : Button(buttonType, {0,0,0,0}, {x,y,0,0}, true, 5, isSelected, GetRadiusFromFont(font)), caption(" "), captionType(capType), surface(nullptr), font(font), colour(colour), backgroundOpacity(bgOpacity) {
+    : Button(buttonType, {0,0,0,0}, {x,y,0,0}, true, 5, isSelected, GetRadiusFromFont(font)), caption(" "), captionType(capType), atlas(nullptr), font(font), colour(colour), backgroundOpacity(bgOpacity) {
 
-    surface = TTF_RenderUTF8_Blended(window->GetFont(font, language), " ", GetColour(colour)); 
-    texture.GetTexture() = SDL_CreateTextureFromSurface(RenderWindow::renderer, surface);
-
-    texture.SrcRect().w = surface->w;
-    texture.SrcRect().h = surface->h;
-    texture.DestRect().w = surface->w;
-    texture.DestRect().h = surface->h;
+    Typeset(language);
 }
 
 TextButton::TextButton(Button::Type buttonType, std::string caption, int x, int y, Colour colour, FontType font, int bgOpacity, bool isSelected, Language language)
     : Button(buttonType, {0,0,0,0}, {x,y,0,0}, true, 5, isSelected, GetRadiusFromFont(font)), caption(caption), captionType(Lang::NONE),
-        surface(nullptr), font(font), colour(colour), backgroundOpacity(bgOpacity)
+        atlas(nullptr), font(font), colour(colour), backgroundOpacity(bgOpacity)
     {
 
-    surface = TTF_RenderUTF8_Blended(window->GetFont(font, language), caption.c_str(), GetColour(colour));    
-    texture.GetTexture() = SDL_CreateTextureFromSurface(RenderWindow::renderer, surface);
-
-    texture.SrcRect().w = surface->w;
-    texture.SrcRect().h = surface->h;
-    texture.DestRect().w = surface->w;
-    texture.DestRect().h = surface->h;
+    Typeset(language);
 }
 
 ImageButton::ImageButton(Button::Type buttonType, SDL_Rect destRect, const char* path, bool isSelected)
@@ -130,7 +151,7 @@ void TextButton::DrawButton() {
     if (backgroundOpacity > 0)
         roundedBoxRGBA(RenderWindow::renderer, texture.GetDestX1() - radius, texture.GetDestY1() - radius, texture.GetDestX2() + radius, texture.GetDestY2() + radius, radius, 255, 255, 255, backgroundOpacity);
     
-    texture.Render();
+    atlas->Draw(layout, texture.GetDestX1(), texture.GetDestY1(), GetColour(colour));
 
     if (isSelected)
         DrawSelectBox();
@@ -254,25 +275,27 @@ void TextButton::DestroySelectBoxTexture() { selectBox.DeleteTexture(); }
 
 Lang::CaptionType TextButton::GetCaptionType() const { return captionType; }
 
-void TextButton::UpdateCaption(std::string newCaption, Language newLanguage) {
+void TextButton::UpdateCaption(std::string_view newCaption, Language newLanguage) {
     caption = newCaption;
+    Typeset(newLanguage);
+}
 
-    SDL_DestroyTexture(texture.GetTexture());
-    SDL_FreeSurface(surface);
-    surface = nullptr;
+void TextButton::Reserve(size_t length) {
+    caption.reserve(length);
+    layout.quads.reserve(length);
+}
 
-    surface = TTF_RenderUTF8_Blended(window->GetFont(font, newLanguage), caption.c_str(), GetColour(colour));    
-    texture.GetTexture() = SDL_CreateTextureFromSurface(RenderWindow::renderer, surface);
+void TextButton::Typeset(Language language) {
+    atlas = &window->GetAtlas(font, language);
+    atlas->Typeset(caption, layout);
 
-    texture.SrcRect().w = surface->w;
-    texture.SrcRect().h = surface->h;
-    texture.DestRect().w = surface->w;
-    texture.DestRect().h = surface->h;
+    texture.SrcRect().w = layout.width;
+    texture.SrcRect().h = layout.height;
+    texture.DestRect().w = layout.width;
+    texture.DestRect().h = layout.height;
 }
 
 TextButton::~TextButton() {
-    SDL_FreeSurface(surface);
-
     #ifdef DTOR
     std::clog << "~TextureButton Dtor" << std::endl;
     #endif
@@ -286,20 +309,35 @@ ImageButton::~ImageButton() {
 /* ************************************************************************************ */
 
 /***** CLASS RENDER_WINDOW *****/
-RenderWindow::RenderWindow(const char* title, int width, int height)
+RenderWindow::RenderWindow(const char* title, int width, int height, int resolutionWidth, int resolutionHeight, Uint32 rendererFlags)
     : window(nullptr), width(width), height(height) {
+    StartupReport::Scope scope("window and renderer");
+
+    if (resolutionWidth <= 0 || resolutionHeight <= 0) {
+        resolutionWidth = width;
+        resolutionHeight = height;
+    }
+    bool isScaled = resolutionWidth != width || resolutionHeight != height;
+
     // Create SDL Window
-    window = SDL_CreateWindow(title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, width, height, 0);
+    window = SDL_CreateWindow(title, SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, resolutionWidth, resolutionHeight, 0);
     if (window == nullptr) {
         std::cerr << "SDL_CreateWindow has failed. Error: " << SDL_GetError() << std::endl;
         exit(1);
     }
+    // Textures are filtered when they are scaled to a different resolution
+    if (isScaled)
+        SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "linear");
+
     // Create SDL Renderer
-    renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+    renderer = SDL_CreateRenderer(window, -1, rendererFlags);
     if (renderer == nullptr) {
         std::cerr << "SDL_CreateRenderer has failed. Error: " << SDL_GetError() << std::endl;
         exit(1);
     }
+    // The game is laid out for the given size, the renderer scales it to the resolution of the window
+    if (isScaled)
+        SDL_RenderSetLogicalSize(renderer, width, height);
 
     Texture::renderer = renderer;
     Button::window = this;
@@ -311,28 +349,9 @@ void RenderWindow::Clear() { SDL_RenderClear(renderer); }
 
 void RenderWindow::Display() { SDL_RenderPresent(renderer); }
 
-void RenderWindow::RenderText(std::string text, int x, int y, Colour colour, FontType font, Language language) {
-    SDL_Surface* captionSurface = nullptr;
-    switch (language) {
-    case ENGLISH:
-    case HUNGARIAN:
-        captionSurface = TTF_RenderUTF8_Blended(latinFonts.GetFont(font), text.c_str(), GetColour(colour));
-        break;
-    case JAPANESE:
-        captionSurface = TTF_RenderUTF8_Blended(japaneseFonts.GetFont(font), text.c_str(), GetColour(colour));
-        break;
-    
-    default:
-        throw "Language not found! RenderWindow::renderText()";
-    }
-    
-    SDL_Texture* captionTexture = SDL_CreateTextureFromSurface(renderer, captionSurface);
-
-    SDL_Rect dest = { .x = x, .y = y, .w = captionSurface->w, .h = captionSurface->h };
-    SDL_RenderCopy(renderer, captionTexture, NULL, &dest);
-
-    SDL_FreeSurface(captionSurface);
-    SDL_DestroyTexture(captionTexture);
+void RenderWindow::RenderText(std::string_view text, int x, int y, Colour colour, FontType font, Language language) {
+    GlyphAtlas& atlas = GetAtlas(font, language);
+    atlas.Draw(atlas.Typeset(text), x, y, GetColour(colour));
 }
 
 void RenderWindow::ApplyTransition(int transparency) {
@@ -344,23 +363,31 @@ void RenderWindow::DrawBackground(int r, int g, int b) {
 }
 
 void RenderWindow::LoadFonts() {
-    japaneseFonts.LoadFont("../res/font/NotoSansJP-Regular.ttf", 30, REG30);
-    latinFonts.LoadFont("../res/font/OpenSans-Regular.ttf", 30, REG30);
+    japaneseFonts.LoadFont("font/NotoSansJP-Regular.ttf", 30, REG30);
+    latinFonts.LoadFont("font/OpenSans-Regular.ttf", 30, REG30);
     
-    japaneseFonts.LoadFont("../res/font/NotoSansJP-Bold.ttf", 100, BOLD100);
-    latinFonts.LoadFont("../res/font/OpenSans-Bold.ttf", 100, BOLD100);
+    japaneseFonts.LoadFont("font/NotoSansJP-Bold.ttf", 100, BOLD100);
+    latinFonts.LoadFont("font/OpenSans-Bold.ttf", 100, BOLD100);
 
-    japaneseFonts.LoadFont("../res/font/NotoSansJP-Medium.ttf", 50, MED50);
-    latinFonts.LoadFont("../res/font/OpenSans-Medium.ttf", 50, MED50);
+    japaneseFonts.LoadFont("font/NotoSansJP-Medium.ttf", 50, MED50);
+    latinFonts.LoadFont("font/OpenSans-Medium.ttf", 50, MED50);
 
-    japaneseFonts.LoadFont("../res/font/NotoSansJP-Medium.ttf", 15, MED15);
-    latinFonts.LoadFont("../res/font/OpenSans-Medium.ttf", 15, MED15);
+    japaneseFonts.LoadFont("font/NotoSansJP-Medium.ttf", 15, MED15);
+    latinFonts.LoadFont("font/OpenSans-Medium.ttf", 15, MED15);
 }
 
 int RenderWindow::GetWidth() const { return width; }
 
 int RenderWindow::GetHeight() const { return height; }
 
+int RenderWindow::GetRefreshRate() const {
+    SDL_DisplayMode mode;
+    int display = SDL_GetWindowDisplayIndex(window);
+    if (display < 0 || SDL_GetCurrentDisplayMode(display, &mode) != 0)
+        return 0;
+    return mode.refresh_rate;
+}
+
 SDL_Renderer* RenderWindow::GetRenderer() { return renderer; }
 
 TTF_Font* RenderWindow::GetFont(FontType font, Language language) {
@@ -376,7 +403,24 @@ TTF_Font* RenderWindow::GetFont(FontType font, Language language) {
     }
 }
 
+GlyphAtlas& RenderWindow::GetAtlas(FontType font, Language language) {
+    switch (language){
+    case ENGLISH:
+    case HUNGARIAN:
+        return latinFonts.GetAtlas(font);
+    case JAPANESE:
+        return japaneseFonts.GetAtlas(font);
+    
+    default:
+        throw "Language not found! RenderWindow::GetAtlas()";
+    }
+}
+
 RenderWindow::~RenderWindow() {
+    // The pages of the atlases belong to the renderer
+    latinFonts.FreeAtlases();
+    japaneseFonts.FreeAtlases();
+
     if (window != nullptr)
         SDL_DestroyWindow(window);
     if (renderer != nullptr)
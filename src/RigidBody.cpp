@@ -5,6 +5,7 @@
 */
 
 #include "RigidBody.h"
+#include "Fixed.h"
 
 #include <iostream>
 
@@ -152,38 +153,85 @@ void RigidBody::Update(float dt) {
 
     acceleration *= scale;
 
-    velocity += acceleration * dt;
+    // Only the velocity change of this update is converted from float, the velocity itself stays in fixed-point
+    velocityX += Fixed::FromFloat(acceleration.x * dt);
+    velocityY += Fixed::FromFloat(acceleration.y * dt);
 
     #ifndef MY_TEST
-    const float crop = 1.5f;
-    if (velocity.x > crop) velocity.x = crop;
-    if (velocity.x < -crop) velocity.x = -crop;
-    if (velocity.y > crop) velocity.y = crop;
-    if (velocity.y < -crop) velocity.y = -crop;
+    const Fixed crop = Fixed::FromFloat(1.5f);
+    if (velocityX > crop) velocityX = crop;
+    if (velocityX < -crop) velocityX = -crop;
+    if (velocityY > crop) velocityY = crop;
+    if (velocityY < -crop) velocityY = -crop;
     #endif
-    
-    position = velocity * dt;
+
+    position = Velocity() * dt;
+
+    Fixed time = Fixed::FromFloat(dt);
+    subPixelX += velocityX * time;
+    subPixelY += velocityY * time;
     // std::clog << "*****\n" << "dt: " << dt << "\nForce: " << force << "\nAcceleration: " <<
-    // acceleration << "\nVelocity: " << velocity << "\nPosition: " << position << std::endl;
+    // acceleration << "\nVelocity: " << Velocity() << "\nPosition: " << position << std::endl;
 }
 
 const Vector2D& RigidBody::GetPosition() const { return position; }
 
+void RigidBody::MoveX(int& x) {
+    int pixels = subPixelX.Floor();
+    subPixelX -= Fixed(pixels);
+    x += pixels;
+}
+
+void RigidBody::MoveY(int& y) {
+    int pixels = subPixelY.Floor();
+    subPixelY -= Fixed(pixels);
+    y += pixels;
+}
+
 void RigidBody::ApplyForce(Vector2D F) { force = F;}
 
 void RigidBody::ApplyForceX(float Fx) { force.x = Fx; }
 
 void RigidBody::ApplyForceY(float Fy) { force.y = Fy; }
 
-void RigidBody::ApplyVelocityX(float vx) { velocity.x = vx; }
+void RigidBody::ApplyVelocityX(float vx) {
+    velocityX = Fixed::FromFloat(vx);
+    if (vx == 0.0f)
+        subPixelX = Fixed();
+}
 
-void RigidBody::ApplyVelocityY(float vy) { velocity.y = vy; }
+void RigidBody::ApplyVelocityY(float vy) {
+    velocityY = Fixed::FromFloat(vy);
+    if (vy == 0.0f)
+        subPixelY = Fixed();
+}
+
+void RigidBody::Drift(Vector2D velocity, float dt) {
+    force = Vector2D(0.0f, 0.0f);
+    acceleration = Vector2D(0.0f, 0.0f);
+    velocityX = Fixed::FromFloat(velocity.x);
+    velocityY = Fixed::FromFloat(velocity.y);
+    position = Velocity() * dt;
+
+    Fixed time = Fixed::FromFloat(dt);
+    subPixelX += velocityX * time;
+    subPixelY += velocityY * time;
+}
+
+void RigidBody::ScaleVelocity(Fixed factor) {
+    // Rounded towards zero (not down), so a damped negative velocity also stops
+    velocityX = Fixed::FromRaw(velocityX.Raw() * factor.Raw() / Fixed::one);
+    velocityY = Fixed::FromRaw(velocityY.Raw() * factor.Raw() / Fixed::one);
+}
 
 void RigidBody::Reset() {
     force = Vector2D(0.0f,0.0f);
     acceleration = Vector2D(0.0f,0.0f);
-    velocity = Vector2D(0.0f,0.0f);
+    velocityX = Fixed();
+    velocityY = Fixed();
     position = Vector2D(0.0f,0.0f);
+    subPixelX = Fixed();
+    subPixelY = Fixed();
 }
 
 float& RigidBody::Mass() { return mass; }
@@ -192,7 +240,7 @@ Vector2D& RigidBody::Force() { return force; };
 
 Vector2D& RigidBody::Position() { return position; };
 
-Vector2D& RigidBody::Velocity() { return velocity; };
+Vector2D RigidBody::Velocity() const { return Vector2D(velocityX.ToFloat(), velocityY.ToFloat()); }
 
 Vector2D& RigidBody::Acceleration() { return acceleration; };
 
@@ -10,65 +10,279 @@
 #include <SDL2/SDL_mixer.h>
 
 #include <iostream>
+#include <string>
+#include <string_view>
+#include <algorithm>
+#include <cstdint>
 
 #include "Sound.h"
+#include "Assets.h"
+#include "PixelCache.h"
+#include "StartupReport.h"
 
-Sound::Sound() : sounds( Sound::COUNT, nullptr) {
-    if ((Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, 1024)) == -1) {
+const int Sound::fadeTime = 500;
+const int Sound::repeatTime = 30;
+
+// CLICK, HAL, SAKANA, BACKGROUND, DEATH, JUMP, ROAR, BREAK, COIN, LASER, FISH, LOBBY, POP, FLAG, ERROR, EMPTY
+const int Sound::priorities[] = { 2, 1, 1, 0, 3, 2, 1, 1, 0, 1, 1, 0, 0, 3, 2, 0 };
+
+Sound::Sound(int bufferSize, int voiceCount) : sounds(Sound::COUNT, nullptr), caches(Sound::COUNT), paths(Sound::COUNT),
+    isFailed(Sound::COUNT, false), isFailureReported(Sound::COUNT, false), isDecoding(false), pendingLoop(Sound::COUNT), isStopping(false),
+    musics(Sound::COUNT, nullptr), nextMusic(Sound::COUNT), nextMusicLoops(0) {
+    StartupReport::Scope scope("audio device");
+    if (SDL_InitSubSystem(SDL_INIT_AUDIO) < 0) {
+        std::cerr << "SDL_InitSubSystem (audio) has failed. Error: " << SDL_GetError() << std::endl;
+        exit(1);
+    }
+    if ((Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, 2, bufferSize)) == -1) {
         std::cerr << "Audio Library not working!" << Mix_GetError() << std::endl;
         exit(1);
     }
-    Mix_AllocateChannels(MAX_CHANNELS);
+    // SDL_mixer's channels are not used, the sound effects are mixed by the Mixer (the format is always 16-bit)
+    Mix_AllocateChannels(0);
+
+    int frequency = 0, channels = 0;
+    Uint16 format = 0;
+    Mix_QuerySpec(&frequency, &format, &channels);
+    mixer = std::make_unique<Mixer>(voiceCount, 64, (std::uint64_t) frequency * channels * repeatTime / 1000);
+    Mix_SetPostMix(&Sound::MixEffects, mixer.get());
 }
 
 void Sound::LoadSound(const char* path, Sound::Type soundType) {
     if (soundType == Sound::COUNT)
         throw "Wrong type!";
-    
+
+    // Music is streamed while playing, it is only opened here
+    if (IsMusic(soundType)) {
+        if (musics[soundType] != nullptr)
+            Mix_FreeMusic(musics[soundType]);
+        musics[soundType] = Mix_LoadMUS_RW(Assets::Open(path), 1);
+        if (musics[soundType] == nullptr)
+            throw "Failed to load Audio";
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
     FreeSound(soundType);
-    
-    sounds[soundType] = Mix_LoadWAV(path);
-    if (sounds[soundType] == nullptr)
-        throw "Failed to load Audio";
+    paths[soundType] = path;
+    isFailed[soundType] = false;
+    isFailureReported[soundType] = false;
+
+    queue.erase(std::remove(queue.begin(), queue.end(), soundType), queue.end());
+    queue.push_back(soundType);
+    if (loader.joinable() == false)
+        loader = std::thread(&Sound::LoadQueuedSounds, this);
+    wakeUp.notify_one();
 }
 
 void Sound::PlaySound(Sound::Type soundType, bool loop) {
     if (soundType == COUNT)
         throw "Wrong type!";
-    if (sounds[soundType] == nullptr)
-        throw "Sound not loaded in!";
-
-    int Loop = 0;
-    if (loop)
-        Loop = -1;
-    
-    int channel = soundType % (MAX_CHANNELS - 1);
-    if (soundType == Sound::BACKGROUND || soundType == Sound::LOBBY)
-        channel = MAX_CHANNELS - 1;
-
-    Mix_PlayChannel(channel, sounds[soundType], Loop);
+
+    if (IsMusic(soundType)) {
+        if (musics[soundType] == nullptr)
+            throw "Sound not loaded in!";
+        PlayMusic(soundType, loop);
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (sounds[soundType] == nullptr) {
+        if (paths[soundType].empty())
+            throw "Sound not loaded in!";
+        if (isFailed[soundType]) {
+            if (isFailureReported[soundType] == false)
+                std::cerr << "Sound failed to load, it is not played: " << paths[soundType] << std::endl;
+            isFailureReported[soundType] = true;
+            return;
+        }
+
+        // Still loading: it is needed now, so it is loaded next
+        auto it = std::find(queue.begin(), queue.end(), soundType);
+        if (it != queue.end()) {
+            queue.erase(it);
+            queue.push_front(soundType);
+        }
+        if (loop)
+            pendingLoop = soundType;
+        return;
+    }
+
+    Mixer::Command command = { Mixer::Command::PLAY, (const std::int16_t*) sounds[soundType]->abuf,
+        sounds[soundType]->alen / (Uint32) sizeof(std::int16_t), soundType, priorities[soundType], loop };
+    if (mixer->Push(command) == false)
+        std::cerr << "Sound queue is full!" << std::endl;
 }
 
 void Sound::StopSound() {
-    Mix_HaltMusic();
-    Mix_PlayChannel(MAX_CHANNELS - 1, sounds[EMPTY], 0);
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pendingLoop = Sound::COUNT;
+    }
+
+    nextMusic = Sound::COUNT;
+    if (Mix_PlayingMusic() && Mix_FadingMusic() != MIX_FADING_OUT)
+        Mix_FadeOutMusic(fadeTime);
 }
 
-void Sound::FreeSound(Sound::Type soundType) {
-    if (sounds[soundType] != nullptr) {
-        Mix_FreeChunk(sounds[soundType]);
-        sounds[soundType] = nullptr;
+void Sound::Update() {
+    if (nextMusic != Sound::COUNT && Mix_PlayingMusic() == 0) {
+        Mix_FadeInMusic(musics[nextMusic], nextMusicLoops, fadeTime);
+        nextMusic = Sound::COUNT;
+    }
+
+    // A looped sound effect requested while it was loading
+    std::lock_guard<std::mutex> lock(mutex);
+    if (pendingLoop != Sound::COUNT && sounds[pendingLoop] != nullptr) {
+        Mixer::Command command = { Mixer::Command::PLAY, (const std::int16_t*) sounds[pendingLoop]->abuf,
+            sounds[pendingLoop]->alen / (Uint32) sizeof(std::int16_t), pendingLoop, priorities[pendingLoop], true };
+        mixer->Push(command);
+        pendingLoop = Sound::COUNT;
     }
 }
 
+bool Sound::IsLoading() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return isDecoding || !queue.empty();
+}
+
+int Sound::GetFailedCount() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return (int) std::count(isFailed.begin(), isFailed.end(), true);
+}
+
 Sound::~Sound() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isStopping = true;
+    }
+    wakeUp.notify_one();
+    if (loader.joinable())
+        loader.join();
+
+    // After this, the audio thread does not use the Mixer
+    Mix_SetPostMix(nullptr, nullptr);
+
     for (Mix_Chunk* sound : sounds)
         if (sound != nullptr)
             Mix_FreeChunk(sound);
 
+    Mix_HaltMusic();
+    for (Mix_Music* music : musics)
+        if (music != nullptr)
+            Mix_FreeMusic(music);
+
     #ifdef DTOR
     std::clog << "~Sound Dtor" << std::endl;
     #endif
 }
+/* ************************************************************************************ */
+
+/***** Private Functions *****/
+void Sound::FreeSound(Sound::Type soundType) {
+    if (sounds[soundType] != nullptr) {
+        // Mix_SetPostMix locks the audio device, so the voices can be stopped while the hook is removed
+        Mix_SetPostMix(nullptr, nullptr);
+        mixer->Stop(soundType);
+        Mix_SetPostMix(&Sound::MixEffects, mixer.get());
+
+        Mix_FreeChunk(sounds[soundType]);
+        sounds[soundType] = nullptr;
+    }
+    caches[soundType].reset();
+}
+
+void Sound::LoadQueuedSounds() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        wakeUp.wait(lock, [this]() { return isStopping || !queue.empty(); });
+        if (isStopping)
+            return;
+
+        Sound::Type soundType = queue.front();
+        queue.pop_front();
+        std::string path = paths[soundType];
+
+        // Decoding takes long, the game can play the loaded sounds meanwhile
+        isDecoding = true;
+        lock.unlock();
+        std::unique_ptr<PixelCache> cache;
+        Mix_Chunk* chunk = nullptr;
+        {
+            StartupReport::Scope scope(path, "sounds");
+            chunk = DecodeSound(path, cache);
+        }
+        lock.lock();
+        isDecoding = false;
+
+        if (chunk == nullptr) {
+            std::cerr << "Failed to load audio: " << path << std::endl;
+            if (paths[soundType] == path)
+                isFailed[soundType] = true;
+            if (pendingLoop == soundType)
+                pendingLoop = Sound::COUNT;
+            continue;
+        }
+        // The sound has been requested again while it was decoded, the newer request wins
+        if (paths[soundType] != path || std::find(queue.begin(), queue.end(), soundType) != queue.end()) {
+            Mix_FreeChunk(chunk);
+            continue;
+        }
+
+        FreeSound(soundType);
+        sounds[soundType] = chunk;
+        caches[soundType] = std::move(cache);
+
+    }
+}
+
+Mix_Chunk* Sound::DecodeSound(const std::string& path, std::unique_ptr<PixelCache>& cache) {
+    std::string buffer;
+    std::string_view source = Assets::Read(path, buffer);
+    if (source.data() == nullptr)
+        return nullptr;
+
+    // The PCM depends on the output of the mixer, so it is part of the key of the cache file
+    int frequency = 0, channels = 0;
+    Uint16 format = 0;
+    Mix_QuerySpec(&frequency, &format, &channels);
+    std::uint32_t spec = ((std::uint32_t) channels << 16) | format;
+    std::uint64_t hash = PixelCache::Hash(source) ^ ((std::uint64_t) frequency << 32);
+    std::string cachePath = Assets::CachePath(path, ".pcm");
+
+    // The PCM is stored as a single row of bytes
+    cache = std::make_unique<PixelCache>();
+    if (cache->Open(cachePath, hash, spec))
+        return Mix_QuickLoad_RAW((Uint8*) cache->GetPixels(), (Uint32) cache->GetHeader().pitch);
+    cache.reset();
+
+    // Cache miss: decode the sound and write the cache
+    Mix_Chunk* chunk = Mix_LoadWAV_RW(SDL_RWFromConstMem(source.data(), source.size()), 1);
+    if (chunk != nullptr && !PixelCache::Store(cachePath, { {}, 0, hash, spec, (std::int32_t) chunk->alen, 1, (std::int32_t) chunk->alen }, chunk->abuf))
+        std::cerr << "Failed to write sound cache: " << cachePath << std::endl;
+    return chunk;
+}
+
+void Sound::PlayMusic(Sound::Type soundType, bool loop) {
+    int loops = loop ? -1 : 1;
+
+    // Only a single music can be streamed, so the next one starts when the current one has faded out (see Update)
+    if (Mix_PlayingMusic()) {
+        if (Mix_FadingMusic() != MIX_FADING_OUT)
+            Mix_FadeOutMusic(fadeTime);
+        nextMusic = soundType;
+        nextMusicLoops = loops;
+        return;
+    }
+
+    nextMusic = Sound::COUNT;
+    Mix_FadeInMusic(musics[soundType], loops, fadeTime);
+}
+
+bool Sound::IsMusic(Sound::Type soundType) { return soundType == Sound::BACKGROUND || soundType == Sound::LOBBY; }
+
+void Sound::MixEffects(void* mixer, Uint8* stream, int length) {
+    ((Mixer*) mixer)->Mix((std::int16_t*) stream, length / sizeof(std::int16_t));
+}
 
-#endif // CPORTA
\ No newline at end of file
+#endif // CPORTA
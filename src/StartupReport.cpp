@@ -0,0 +1,108 @@
+/** @file StartupReport.cpp
+  * @brief Contains the implementation of StartupReport.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <mutex>
+#include <chrono>
+
+#include "StartupReport.h"
+
+/***** Class Scope *****/
+StartupReport::Scope::Scope(const std::string& name, const std::string& thread, StartupReport& report)
+    : report(report), name(name), thread(thread), begin(Clock::now()) {}
+
+StartupReport::Scope::~Scope() { report.Add(name, thread, begin, Clock::now()); }
+/* ************************************************************************************ */
+
+/***** Class StartupReport *****/
+StartupReport::StartupReport(Clock::time_point origin) : origin(origin), isFinished(false) {}
+
+StartupReport& StartupReport::Instance() {
+    static StartupReport report;
+    return report;
+}
+
+void StartupReport::Add(const std::string& name, const std::string& thread, Clock::time_point begin, Clock::time_point end) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (isFinished)
+        return;
+    phases.push_back({name, thread, Since(begin), std::chrono::duration<double, std::milli>(end - begin).count()});
+}
+
+void StartupReport::Mark(const std::string& name, Clock::time_point time) { Add(name, "", time, time); }
+
+void StartupReport::Finish(Clock::time_point time) {
+    Mark("startup finished", time);
+    std::lock_guard<std::mutex> lock(mutex);
+    isFinished = true;
+}
+
+bool StartupReport::IsFinished() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return isFinished;
+}
+
+std::vector<StartupReport::Phase> StartupReport::GetPhases() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<Phase> sorted = phases;
+    std::stable_sort(sorted.begin(), sorted.end(), [](const Phase& a, const Phase& b) { return a.start < b.start; });
+    return sorted;
+}
+
+double StartupReport::GetMilestone(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const Phase& phase : phases)
+        if (phase.thread.empty() && phase.name == name)
+            return phase.start;
+    return -1.0;
+}
+
+double StartupReport::GetBusyTime(const std::string& thread) {
+    double sum = 0.0, end = 0.0;
+    for (const Phase& phase : GetPhases()) {
+        if (phase.thread != thread)
+            continue;
+
+        // Nested phases (e.g. a texture uploaded while building a button) are only counted once
+        double start = std::max(phase.start, end);
+        end = std::max(end, phase.start + phase.duration);
+        sum += std::max(0.0, end - start);
+    }
+    return sum;
+}
+
+void StartupReport::Print(std::ostream& os) {
+    std::vector<Phase> sorted = GetPhases();
+
+    os << "Startup report (milliseconds since the start of the program):" << std::endl;
+    os << std::fixed << std::setprecision(1);
+    os << "     start  duration  thread      phase" << std::endl;
+    std::vector<std::string> threads;
+    for (const Phase& phase : sorted) {
+        if (phase.thread.empty()) {
+            os << "  " << std::setw(8) << phase.start << "  ---- " << phase.name << " ----" << std::endl;
+            continue;
+        }
+        os << "  " << std::setw(8) << phase.start << "  " << std::setw(8) << phase.duration << "  "
+            << std::left << std::setw(10) << phase.thread << std::right << "  " << phase.name << std::endl;
+        if (std::find(threads.begin(), threads.end(), phase.thread) == threads.end())
+            threads.push_back(phase.thread);
+    }
+
+    os << "Busy time of the threads:" << std::endl;
+    for (const std::string& thread : threads)
+        os << "  " << std::left << std::setw(10) << thread << std::right << "  " << std::setw(8) << GetBusyTime(thread) << std::endl;
+    os << std::defaultfloat;
+}
+/* ************************************************************************************ */
+
+/***** Private Functions *****/
+double StartupReport::Since(Clock::time_point time) const { return std::chrono::duration<double, std::milli>(time - origin).count(); }
+/* ************************************************************************************ */
@@ -11,15 +11,20 @@
 
 #include <iostream>
 #include <string>
+#include <memory>
 
 #include "Texture.h"
+#include "ImageLoader.h"
+#include "StartupReport.h"
 
 SDL_Renderer* Texture::renderer = nullptr;
+ImageLoader* Texture::loader = nullptr;
+Uint32 Texture::nativeFormat = SDL_PIXELFORMAT_UNKNOWN;
 
 SDL_Texture* Texture::LoadStaticTexture(std::string path) {
-    SDL_Texture* staticTexture = IMG_LoadTexture(Texture::renderer, path.c_str());
+    SDL_Texture* staticTexture = CreateTexture(path);
     
-    if (staticTexture == nullptr)
+    if (staticTexture == nullptr && Texture::renderer != nullptr)
         std::cerr << "Failed to load static texture. Error: " << SDL_GetError() << std::endl;
 
     return staticTexture;
@@ -54,8 +59,8 @@ void Texture::LoadTexture(std::string path) {
     if (isStatic == false)
         DeleteTexture();
 
-    texture = IMG_LoadTexture(Texture::renderer, path.c_str());
-    if (texture == nullptr)
+    texture = CreateTexture(path);
+    if (texture == nullptr && Texture::renderer != nullptr)
         std::cerr << "Failed to load texture. Error: " << SDL_GetError() << std::endl;
 }
 
@@ -88,6 +93,53 @@ Texture::~Texture() {
     std::clog << "~Texture Dtor" << std::endl;
     #endif
 }
+/* ************************************************************************************ */
+
+/***** Private Functions *****/
+Uint32 Texture::GetNativeFormat() {
+    if (nativeFormat != SDL_PIXELFORMAT_UNKNOWN)
+        return nativeFormat;
+
+    nativeFormat = SDL_PIXELFORMAT_ARGB8888;
+    SDL_RendererInfo info;
+    if (SDL_GetRendererInfo(Texture::renderer, &info) == 0) {
+        for (Uint32 i = 0; i < info.num_texture_formats; ++i) {
+            if (SDL_ISPIXELFORMAT_ALPHA(info.texture_formats[i])) {
+                nativeFormat = info.texture_formats[i];
+                break;
+            }
+        }
+    }
+    return nativeFormat;
+}
+
+SDL_Texture* Texture::CreateTexture(const std::string& path) {
+    // Headless simulation: there is nothing to render to
+    if (Texture::renderer == nullptr)
+        return nullptr;
+
+    StartupReport::Scope scope(path);
+    std::shared_ptr<const ImageLoader::Image> image = loader != nullptr ? loader->Get(path) : nullptr;
+    if (image == nullptr)
+        image = ImageLoader::Decode(path, GetNativeFormat());
+    if (image == nullptr)
+        return nullptr;
+
+    return UploadPixels(image->width, image->height, image->pixels, image->pitch);
+}
+
+SDL_Texture* Texture::UploadPixels(int width, int height, const void* pixels, int pitch) {
+    SDL_Texture* texture = SDL_CreateTexture(Texture::renderer, GetNativeFormat(), SDL_TEXTUREACCESS_STATIC, width, height);
+    if (texture == nullptr)
+        return nullptr;
+
+    if (SDL_UpdateTexture(texture, nullptr, pixels, pitch) < 0) {
+        SDL_DestroyTexture(texture);
+        return nullptr;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    return texture;
+}
 
 
 
@@ -12,22 +12,24 @@
 
 #include "Timer.h"
 
-Timer::Timer() : isActive(false), setDuration(1) {}
+Timer::Timer() : isActive(false), setDuration(1), clock(SDL_GetTicks) {}
 
-Timer::Timer(size_t milliSeconds) : isActive(true), startTicks(SDL_GetTicks()), setDuration(milliSeconds) {}
+Timer::Timer(size_t milliSeconds) : isActive(true), startTicks(SDL_GetTicks()), setDuration(milliSeconds), clock(SDL_GetTicks) {}
+
+Timer::Timer(Uint32 (*clock)()) : isActive(false), setDuration(1), clock(clock) {}
 
 void Timer::Deactivate() { isActive = false; }
 
 void Timer::Activate(size_t milliSeconds) {
     isActive = true;
     setDuration = milliSeconds;
-    startTicks = SDL_GetTicks();
+    startTicks = clock();
 }
 
 size_t Timer::GetTime() const {
     if (!isActive)
         return 0;
-    return SDL_GetTicks() - startTicks;
+    return clock() - startTicks;
 }
 
 bool Timer::IsActive() const { return isActive; }
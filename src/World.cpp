@@ -0,0 +1,38 @@
+/** @file World.cpp
+  * @brief Contains the implementation of World.h
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#ifndef CPORTA
+
+#include <SDL2/SDL.h>
+
+#include <iostream>
+
+#include "World.h"
+
+/**
+ * @brief Used when no world is bound to the thread, so World::Current() is always valid.
+ */
+static thread_local World emptyWorld;
+
+/**
+ * @brief The world that is bound to the thread.
+ */
+static thread_local World* currentWorld = nullptr;
+
+World::World() : screen({0, 0, 1600, 900}), playerPosition(0), isCompleted(false), time(0), exactTime(0.0) {}
+
+World& World::Current() { return currentWorld != nullptr ? *currentWorld : emptyWorld; }
+
+Uint32 World::Time() { return Current().time; }
+
+void World::Bind(World& world) { currentWorld = &world; }
+
+void World::Unbind(World& world) {
+    if (currentWorld == &world)
+        currentWorld = nullptr;
+}
+
+#endif // CPORTA
@@ -26,26 +26,67 @@
 
 #include <iostream>
 #include <string>
+#include <cstring>
 
 #include "GameEngine.h"
 #include "RenderWindow.h"
+#include "Assets.h"
+#include "AllocTracker.h"
+#include "StartupReport.h"
+#include "PerformanceConfig.h"
 
 int main(int argc, char* argv[]) {
     #ifndef CPORTA
 
-    if (SDL_Init(SDL_INIT_EVERYTHING) < 0) {
-        std::cerr << "SDL_Init has failed. Error: " << SDL_GetError() << std::endl;
-        exit(1);
+    {
+        StartupReport::Scope scope("SDL_Init");
+        // Only the subsystems that are used: audio is initialised by Sound, there is no joystick, haptic or sensor support
+        if (SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS | SDL_INIT_TIMER) < 0) {
+            std::cerr << "SDL_Init has failed. Error: " << SDL_GetError() << std::endl;
+            exit(1);
+        }
     }
+    {
+        StartupReport::Scope scope("Assets::Init");
+        Assets::Init();
+    }
+
+    // The performance settings are needed before the window is created: config.txt next to the executable, then the command line
+    PerformanceConfig config;
+    std::string defaultConfigPath = Assets::LocalPath("config.txt");
+    std::string configPath = PerformanceConfig::GetPath(argc, argv, defaultConfigPath);
+    config.LoadFile(configPath, std::cerr, configPath != defaultConfigPath);
+    config.ParseArguments(argc, argv, std::cerr);
 
-    RenderWindow window("Cat Mario", 1600, 900);
-    GameEngine engine(window);
+    Uint32 rendererFlags = config.software ? SDL_RENDERER_SOFTWARE : SDL_RENDERER_ACCELERATED;
+    if (config.vsync)
+        rendererFlags |= SDL_RENDERER_PRESENTVSYNC;
+    RenderWindow window("Cat Mario", 1600, 900, config.width, config.height, rendererFlags);
+    GameEngine engine(window, config);
 
     // This function is called, because TextButtons are filled up with a space
     // by the constructor and the translation is stored in GameEngine.
-    engine.UpdateButtons();
+    {
+        StartupReport::Scope scope("title caption");
+        engine.UpdateButtons();
+    }
+
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--startup-report") == 0)
+            engine.SetStartupReport(true);
+        if (std::strcmp(argv[i], "--pacing-report") == 0)
+            engine.SetPacingReport(true);
+        #ifdef ALLOC_TRACK
+        if (std::strcmp(argv[i], "--assert-no-alloc") == 0)
+            engine.SetAssertNoAlloc(true);
+        #endif
+    }
 
     while (engine.GetExitProgram() == false) {
+        #ifdef ALLOC_TRACK
+        AllocTracker::BeginFrame();
+        #endif
+
         // 1. Handling events one-by-one
         engine.HandleEvents();
 
@@ -54,13 +95,24 @@ int main(int argc, char* argv[]) {
         engine.HandleSceneChanges();
         engine.UpdateGame();
 
-        // 3. Display
-        window.Clear();
-        engine.RenderItems();
-        engine.ApplyTransition();
-        window.Display();
-
-        // 4. Applys even FPS by delaying
+        // 3. Display (skipped while minimized, or if nothing has changed while idle)
+        if (engine.IsRedrawNeeded()) {
+            window.Clear();
+            engine.RenderItems();
+            engine.ApplyTransition();
+            window.Display();
+            #ifdef LATENCY
+            engine.FramePresented();
+            #endif
+        }
+        #ifdef ALLOC_TRACK
+        engine.CheckAllocations();
+        #endif
+
+        // The rest of the startup is loaded in the idle time of the frame
+        engine.LoadIncrementally();
+
+        // 4. Applys even FPS by waiting until the end of the frame (see FramePacer)
         engine.ApplyEvenFPS();
             
         // std::clog << "Frametime: " << GameEngine::frameTime << " ms" << std::endl;
@@ -14,13 +14,39 @@
 
 #include "gtest_lite.h"
 #include "RigidBodyTest.hpp"
+#include "FixedTest.hpp"
 #include "LanguageModuleTest.hpp"
+#include "LevelGeneratorTest.hpp"
+#include "AssetPackTest.hpp"
+#include "PixelCacheTest.hpp"
+#include "MixerTest.hpp"
+#include "InputTest.hpp"
+#include "LatencyProbeTest.hpp"
+#include "ArenaTest.hpp"
+#include "AllocTrackerTest.hpp"
+#include "StartupReportTest.hpp"
+#include "PerformanceConfigTest.hpp"
+#include "LevelRegistryTest.hpp"
+#include "FramePacerTest.hpp"
 
 int main() {
     GTINIT(std::cin); // Csak C(J)PORTA működéséhez kell
     
     TEST_RigidBody();
+    TEST_Fixed();
     TEST_LanguageModule();
+    TEST_LevelGenerator();
+    TEST_AssetPack();
+    TEST_PixelCache();
+    TEST_Mixer();
+    TEST_Input();
+    TEST_LatencyProbe();
+    TEST_Arena();
+    TEST_AllocTracker();
+    TEST_StartupReport();
+    TEST_PerformanceConfig();
+    TEST_LevelRegistry();
+    TEST_FramePacer();
 
     GTEND(std::cerr); // Csak C(J)PORTA működéséhez kell
     return 0;
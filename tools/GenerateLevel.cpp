@@ -0,0 +1,91 @@
+/** @file GenerateLevel.cpp
+  * @brief Command line tool that generates stress-test levels.
+  *
+  * It writes a level config file with the given size, block density,
+  * enemy and element counts using class LevelGenerator. Levels
+  * generated with the same seed are identical, so they can be used
+  * for comparing benchmarks.
+  *
+  * Usage example (generates a 10 000 column wide level):
+  *   ./Level-Generator --width 10000 --density 0.1 --common 1000 --soldier 500
+  *       --fish 200 --laser 100 --tube 300 --cloud 200 --seed 42 -o ../res/levels/Stress.txt
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#include <iostream>
+#include <string>
+#include <cstring>
+
+#include "LevelGenerator.h"
+
+/**
+ * @brief Prints the usage of the program.
+ * @param program Name of the program.
+ */
+void PrintUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [options] -o <output>\n"
+        << "  --width <blocks>      Width of the grid (default: 200)\n"
+        << "  --density <0..1>      Density of the floating blocks (default: 0.1)\n"
+        << "  --common <count>      Number of common enemies\n"
+        << "  --soldier <count>     Number of soldier enemies\n"
+        << "  --king <count>        Number of king enemies\n"
+        << "  --red <count>         Number of red mushroom enemies\n"
+        << "  --purple <count>      Number of purple mushroom enemies\n"
+        << "  --fish <count>        Number of fish\n"
+        << "  --laser <count>       Number of lasers\n"
+        << "  --tube <count>        Number of tubes\n"
+        << "  --cloud <count>       Number of clouds\n"
+        << "  --seed <number>       Seed of the random generator (default: 0)\n"
+        << "  -o <output>           Path to the generated level file" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    GeneratorConfig config;
+    std::string output;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            if (i + 1 >= argc) {
+                PrintUsage(argv[0]);
+                return 1;
+            }
+            const char* option = argv[i];
+            std::string value = argv[++i];
+
+            if (std::strcmp(option, "--width") == 0) config.width = std::stoi(value);
+            else if (std::strcmp(option, "--density") == 0) config.blockDensity = std::stof(value);
+            else if (std::strcmp(option, "--common") == 0) config.commonEnemies = std::stoi(value);
+            else if (std::strcmp(option, "--soldier") == 0) config.soldierEnemies = std::stoi(value);
+            else if (std::strcmp(option, "--king") == 0) config.kingEnemies = std::stoi(value);
+            else if (std::strcmp(option, "--red") == 0) config.redMushroomEnemies = std::stoi(value);
+            else if (std::strcmp(option, "--purple") == 0) config.purpleMushroomEnemies = std::stoi(value);
+            else if (std::strcmp(option, "--fish") == 0) config.fish = std::stoi(value);
+            else if (std::strcmp(option, "--laser") == 0) config.lasers = std::stoi(value);
+            else if (std::strcmp(option, "--tube") == 0) config.tubes = std::stoi(value);
+            else if (std::strcmp(option, "--cloud") == 0) config.clouds = std::stoi(value);
+            else if (std::strcmp(option, "--seed") == 0) config.seed = std::stoul(value);
+            else if (std::strcmp(option, "-o") == 0) output = value;
+            else {
+                PrintUsage(argv[0]);
+                return 1;
+            }
+        }
+
+        if (output.empty()) {
+            PrintUsage(argv[0]);
+            return 1;
+        }
+
+        LevelGenerator generator(config);
+        generator.Generate(output);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Failed to generate level: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::clog << "Level generated: " << output << std::endl;
+    return 0;
+}
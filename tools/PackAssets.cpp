@@ -0,0 +1,38 @@
+/** @file PackAssets.cpp
+  * @brief Command line tool that packs the res/ directory into a single asset pack.
+  *
+  * The game maps the pack (bin/res.pak) at startup instead of opening every
+  * resource one-by-one. Without the pack the loose files of res/ are used.
+  *
+  * Usage example:
+  *   ./Pack-Assets ../res ../bin/res.pak
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#include <iostream>
+#include <string>
+
+#include "AssetPack.h"
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <resource directory> <output>" << std::endl;
+        return 1;
+    }
+
+    try {
+        size_t count = AssetPack::Build(argv[1], argv[2]);
+
+        AssetPack pack;
+        if (!pack.Open(argv[2]) || pack.Count() != count)
+            throw std::runtime_error("The created asset pack is invalid!");
+
+        std::clog << "Packed " << count << " assets into " << argv[2] << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+    return 0;
+}
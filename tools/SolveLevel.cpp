@@ -0,0 +1,104 @@
+/** @file SolveLevel.cpp
+  * @brief Command line tool that checks whether a level can be completed.
+  *
+  * It runs class LevelSolver on the level without opening a window, and
+  * prints whether the end flag has been reached. If not, the furthest
+  * position is printed, which marks the unreachable section of the level.
+  * The found input sequence can be written to a file.
+  *
+  * Usage example:
+  *   ./Level-Solver levels/Level1.txt --beam 128 --ticks 10 --threads 8 --seed 42 -o Level1.inputs
+  *
+  * @author Bácsi Miklós
+  * @date 2025-05-18
+*/
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstring>
+#include <chrono>
+
+#include "LevelSolver.h"
+#include "Assets.h"
+
+/**
+ * @brief Prints the usage of the program.
+ * @param program Name of the program.
+ */
+void PrintUsage(const char* program) {
+    std::cerr << "Usage: " << program << " <level> [options]\n"
+        << "  <level>               Path to the level file relative to res/ (e.g. levels/Level1.txt)\n"
+        << "  --beam <count>        Number of states kept in every step (default: 64)\n"
+        << "  --ticks <count>       Number of update cycles an action is held for (default: 10)\n"
+        << "  --actions <count>     Maximum length of the input sequence (default: 2000)\n"
+        << "  --stall <count>       Give up after this many actions without progress (default: 100)\n"
+        << "  --threads <count>     Number of worker threads (default: all hardware threads)\n"
+        << "  --seed <number>       Seed of the spawns of the mystery blocks (default: 0)\n"
+        << "  -o <output>           Path to the file of the input sequence" << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        PrintUsage(argv[0]);
+        return 1;
+    }
+
+    SolverConfig config;
+    std::string level = argv[1];
+    std::string output;
+
+    try {
+        for (int i = 2; i < argc; ++i) {
+            if (i + 1 >= argc) {
+                PrintUsage(argv[0]);
+                return 1;
+            }
+            const char* option = argv[i];
+            std::string value = argv[++i];
+
+            if (std::strcmp(option, "--beam") == 0) config.beamWidth = std::stoi(value);
+            else if (std::strcmp(option, "--ticks") == 0) config.ticksPerAction = std::stoi(value);
+            else if (std::strcmp(option, "--actions") == 0) config.maxActions = std::stoi(value);
+            else if (std::strcmp(option, "--stall") == 0) config.stallLimit = std::stoi(value);
+            else if (std::strcmp(option, "--threads") == 0) config.threads = std::stoi(value);
+            else if (std::strcmp(option, "--seed") == 0) config.seed = std::stoul(value);
+            else if (std::strcmp(option, "-o") == 0) output = value;
+            else {
+                PrintUsage(argv[0]);
+                return 1;
+            }
+        }
+
+        Assets::Init();
+
+        auto start = std::chrono::steady_clock::now();
+        LevelSolver solver(config);
+        SolverResult result = solver.Solve(level);
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+        if (result.isCompleted)
+            std::cout << "Completed: " << level << " in " << result.actions.size() * config.ticksPerAction << " update cycles" << std::endl;
+        else
+            std::cout << "Not completed: " << level << ", furthest x coordinate: " << result.furthestX
+                << " (column " << result.furthestX / SCALED_BLOCK_SIZE << ")" << std::endl;
+        std::cout << "Simulated " << result.simulatedTicks << " update cycles in " << elapsed.count() << " ms" << std::endl;
+
+        if (!output.empty()) {
+            std::ofstream file(output);
+            if (!file)
+                throw std::runtime_error("Unable to open output file: " + output);
+            solver.WriteInputs(file, result);
+        }
+
+        return result.isCompleted ? 0 : 2;
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Failed to solve level: " << e.what() << std::endl;
+        return 1;
+    }
+    catch (const char* e) {
+        std::cerr << "Failed to solve level: " << e << std::endl;
+        return 1;
+    }
+}